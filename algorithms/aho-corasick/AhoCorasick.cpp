@@ -0,0 +1,152 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+
+#include "AhoCorasick.h"
+
+/**
+ * @file AhoCorasick.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the Aho-Corasick automaton, and a benchmark of scanning a generated log
+ *      stream for 100,000 keywords at once
+ */
+
+std::string keywords[] = {"he", "she", "his", "hers", "error", "err"};
+std::string text = "ushers raised an error: she said his errand was hers";
+static int benchmarkKeywords = 100000;                  // Keywords in the benchmark
+static size_t benchmarkBytes = 256 << 20;               // Bytes of log in the benchmark
+static size_t chunkBytes = 64 << 10;                    // Bytes per call to Scan()
+
+/**
+ * @brief The MakeWord() function builds a pronounceable word out of 3 to 5 syllables.
+ * @param rng The random number generator
+ * @return Returns the word
+ */
+std::string MakeWord(std::mt19937& rng)
+{
+    static const char* consonants = "bcdfghjklmnprstvwz";
+    static const char* vowels = "aeiou";
+    std::string word;
+    int syllables = 3 + rng() % 3;
+
+    for (int i = 0; i < syllables; i++)
+    {
+        word += consonants[rng() % 18];
+        word += vowels[rng() % 5];
+    }
+
+    return word;
+}
+
+/**
+ * @brief The MakeLog() function builds log lines with a timestamp, a level, a request id and a message, where
+ *      one line in a hundred mentions a keyword.
+ * @param keywords The keywords
+ * @param bytes The size of the log
+ * @return Returns the log
+ */
+std::string MakeLog(const std::vector<std::string>& keywords, size_t bytes)
+{
+    static const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+    static const char* messages[] = {"GET /api/v2/orders 200", "connection reset by peer",
+        "cache miss for session", "retrying upstream request", "POST /api/v2/login 401"};
+    std::mt19937 rng(7);
+    std::string log;
+    char line[160];
+
+    log.reserve(bytes + sizeof(line));
+
+    for (long long second = 0; log.size() < bytes; second++)
+    {
+        snprintf(line, sizeof(line), "2024-05-%02lld %02lld:%02lld:%02lld.%03u [%s] req=%08x %s", 1 + second / 86400 % 28,
+            second / 3600 % 24, second / 60 % 60, second % 60, (unsigned) (rng() % 1000), levels[rng() % 4],
+            (unsigned) rng(), messages[rng() % 5]);
+        log += line;
+
+        if (rng() % 100 == 0)
+            log += " user=" + keywords[rng() % keywords.size()];
+
+        log += '\n';
+    }
+
+    return log;
+}
+
+/**
+ * @brief The Benchmark() function scans a log in chunks and prints the throughput.
+ * @param name Name of the configuration
+ * @param automaton The automaton
+ * @param log The log
+ */
+void Benchmark(const char* name, AhoCorasick& automaton, const std::string& log)
+{
+    size_t matches = 0;
+    std::string_view stream(log);
+
+    automaton.Reset();
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t offset = 0; offset < stream.size(); offset += chunkBytes)
+        automaton.Scan(stream.substr(offset, chunkBytes), [&](uint64_t, int, uint32_t) { matches++; });
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-22s %7u dense states, %6.1f MB, %7.2f MB/s, %zu matches\n", name, automaton.DenseStateCount(),
+        automaton.MemoryUsage() / 1e6, log.size() / seconds / 1e6, matches);
+}
+
+int main()
+{
+    Trie trie;
+
+    // Find the keywords in a short text, fed in chunks of 5 bytes
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Scanning \"" << text << "\"..." << std::endl;
+
+    for (auto& keyword : keywords)
+        trie.Insert(keyword);
+
+    AhoCorasick automaton(trie);
+
+    for (size_t offset = 0; offset < text.size(); offset += 5)
+    {
+        automaton.Scan(std::string_view(text).substr(offset, 5), [&](uint64_t position, int length, uint32_t pattern)
+        {
+            std::cout << "\"" << automaton.Pattern(pattern) << "\" at " << position << ": "
+                << text.substr(position, length) << std::endl;
+        });
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    trie.Clear();
+
+    // Scan a log for many keywords, with and without the dense rows
+    std::mt19937 rng(42);
+    std::vector<std::string> words(benchmarkKeywords);
+
+    for (auto& word : words)
+    {
+        word = MakeWord(rng);
+        trie.Insert(word);
+    }
+
+    std::string log = MakeLog(words, benchmarkBytes);
+    auto start = std::chrono::steady_clock::now();
+    AhoCorasick dense(trie);
+    double build = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    AhoCorasick sparse(trie, 1);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    printf("%u keywords, %u states, built in %.2f s; scanning %.0f MB in %zu KB chunks...\n",
+        dense.PatternCount(), dense.StateCount(), build, log.size() / 1e6, chunkBytes >> 10);
+
+    Benchmark("Dense rows near root:", dense, log);
+    Benchmark("Failure links only:", sparse, log);
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
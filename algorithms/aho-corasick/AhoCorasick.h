@@ -0,0 +1,362 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+
+#include "../../data-structures/trie/Trie.h"
+
+/**
+ * @file AhoCorasick.h
+ * @author 0xChristopher
+ * @brief The Aho-Corasick automaton finds every occurrence of every word of a Trie in a text, in a single
+ *      pass over the text. Each node of the Trie becomes a state of the automaton, and reading a byte moves
+ *      from a state to its child for that byte. When there is no such child, the automaton follows the
+ *      failure link of the state instead: the state of the longest proper suffix of the current match that
+ *      is still a prefix of some word. No byte of the text is ever read twice.
+ *
+ *      A state ends a word when its own prefix is a word, and its output link points to the nearest state
+ *      along the failure links that ends a word. Following the output links from a state therefore reports
+ *      exactly the words that end at the current byte, without walking the failure links that end none.
+ *
+ *      States are numbered in breadth-first order, so the states closest to the root come first. Almost all
+ *      of the time on real text is spent near the root, so the first 'denseStates' states get a full row of
+ *      precomputed transitions with the failure links already folded in, and the scan loop reads one table
+ *      entry per byte. Entries that lead to a state that reports matches are marked, so a single comparison
+ *      per byte decides whether there is anything to report. Deeper states keep only their own children,
+ *      sorted by byte, and fall back on their failure links.
+ *
+ *      A row has one entry per byte class rather than per byte: every byte that occurs in the words gets a
+ *      class of its own, and all other bytes share class 0, since they all lead to the same state. Word
+ *      lists in one script use a few dozen bytes, so the rows shrink from 1 KB to about 128 bytes and many
+ *      more of them stay in cache. Finally, the bytes that start no word at all are skipped in a tight loop
+ *      whenever the automaton is at the root; unlike the transitions, these checks don't wait on each other.
+ *
+ *      Scan() keeps the current state and the position in the stream between calls, so a text can be fed
+ *      in chunks of any size and a word that straddles two chunks is still found. The automaton is a
+ *      snapshot of the Trie at the time it was built; later changes to the Trie are not seen.
+ *
+ *      Time Complexity: O(m * log(a)) to build from a Trie of m nodes with at most a children per node, plus
+ *          one row per dense state; O(n + z) to scan a text of n bytes with z matches
+ *      Space Complexity: O(m) plus up to 1 KB per dense state
+ */
+
+class AhoCorasick
+{
+
+    public:
+    /**
+     * @brief Called once per match with the position of its first byte in the stream, its length, and the
+     *      id of the word that matched (see Pattern()).
+     */
+    using MatchCallback = std::function<void(uint64_t position, int length, uint32_t pattern)>;
+
+    static constexpr uint32_t DEFAULT_DENSE_STATES = 16384; // Dense states unless told otherwise
+
+    private:
+    static constexpr uint32_t ROOT = 0;                 // State of the empty prefix
+    static constexpr uint32_t NONE = UINT32_MAX;        // Missing output link
+    static constexpr uint32_t SLOW = 1u << 31;          // Marks an entry whose target reports matches
+
+    std::vector<uint32_t> table;                        // One transition per byte class and dense state
+    std::vector<uint32_t> firstChild;                   // First child of every state, plus one past the last
+    std::vector<uint8_t> label;                         // Byte that leads from the parent to every state
+    std::vector<uint32_t> parent;                       // Parent of every state
+    std::vector<uint32_t> fail;                         // Failure link of every state
+    std::vector<uint32_t> output;                       // Output link of every state, or NONE
+    std::vector<uint32_t> depth;                        // Length of the prefix of every state
+    std::vector<uint8_t> isPattern;                     // Whether the prefix of a state is a word
+    uint32_t denseStates;                               // Number of states with a row in the table
+    uint32_t numClasses = 1;                            // Number of byte classes
+    uint32_t rowShift = 0;                              // Log2 of the width of a row, numClasses rounded up
+    uint8_t byteClass[256] = {};                        // Class of every byte; bytes in no word share class 0
+    bool startsWord[256] = {};                          // Whether a byte leads away from the root
+    uint32_t numPatterns = 0;                           // Number of words
+    uint32_t state = ROOT;                              // Current state of the stream
+    uint64_t position = 0;                              // Bytes of the stream scanned so far
+
+    /**
+     * @brief The Goto() function finds the child of a state for a byte, searching its sorted children.
+     * @param s The state
+     * @param c The byte
+     * @return Returns the child, or ROOT if there is none
+     */
+    uint32_t Goto(uint32_t s, uint8_t c) const
+    {
+        auto first = label.begin() + firstChild[s];
+        auto last = label.begin() + firstChild[s + 1];
+        auto it = std::lower_bound(first, last, c);
+
+        return (it != last && *it == c) ? (uint32_t) (it - label.begin()) : ROOT;
+    }
+
+    /**
+     * @brief The Next() function moves from a state by a byte, following failure links until a state has
+     *      a child for the byte or has a dense row.
+     * @param s The state
+     * @param c The byte
+     * @return Returns the table entry of the next state, marked with SLOW if it must not take the fast path
+     */
+    uint32_t Next(uint32_t s, uint8_t c) const
+    {
+        while (s >= denseStates)
+        {
+            uint32_t child = Goto(s, c);
+
+            if (child != ROOT)
+                return Entry(child);
+
+            s = fail[s];
+        }
+
+        return table[((size_t) s << rowShift) + byteClass[c]];
+    }
+
+    /**
+     * @brief The Entry() function encodes a state as a table entry.
+     * @param s The state
+     * @return Returns the state, marked with SLOW if it reports matches
+     */
+    uint32_t Entry(uint32_t s) const
+    {
+        return (isPattern[s] || output[s] != NONE) ? (s | SLOW) : s;
+    }
+
+    /**
+     * @brief The Report() function reports the words that end at the current byte in state s, longest
+     *      first.
+     * @param s The state
+     * @param end Position in the stream one past the current byte
+     * @param callback Receives every match
+     */
+    void Report(uint32_t s, uint64_t end, const MatchCallback& callback) const
+    {
+        if (!isPattern[s])
+            s = output[s];
+
+        for (; s != NONE; s = output[s])
+            callback(end - depth[s], (int) depth[s], s);
+    }
+
+    public:
+    /**
+     * @brief AhoCorasick constructor, which builds the automaton of the words in a Trie.
+     * @param trie The Trie holding the words to look for
+     * @param denseStates The number of states nearest the root that get a full row of transitions
+     */
+    AhoCorasick(Trie& trie, uint32_t denseStates = DEFAULT_DENSE_STATES)
+    {
+        // Number the nodes of the Trie breadth first; the children of a state then get consecutive numbers
+        // in byte order, so the children of every state are a sorted range of 'label'
+        std::vector<uint32_t> trieNode(1, Trie::ROOT);
+
+        parent.push_back(ROOT);
+        label.push_back(0);
+        depth.push_back(0);
+        isPattern.push_back(0);
+
+        for (uint32_t s = 0; s < trieNode.size(); s++)
+        {
+            firstChild.push_back((uint32_t) trieNode.size());
+
+            trie.ForEachChild(trie.nodes[trieNode[s]], [&](unsigned char c, uint32_t child)
+            {
+                const Node& node = trie.nodes[child];
+
+                trieNode.push_back(child);
+                parent.push_back(s);
+                label.push_back(c);
+                depth.push_back(depth[s] + 1);
+                isPattern.push_back(node.isWordEnding && node.ends > 0);
+                numPatterns += isPattern.back();
+            });
+        }
+
+        uint32_t numStates = (uint32_t) trieNode.size();
+        firstChild.push_back(numStates);
+
+        if (numStates >= SLOW)
+            throw "Too many states";
+
+        // A failure link always leads to a shallower state, which comes earlier in breadth-first order, so
+        // the links of every state are known by the time its children need them
+        fail.assign(numStates, ROOT);
+        output.assign(numStates, NONE);
+
+        for (uint32_t s = 1; s < numStates; s++)
+        {
+            if (parent[s] != ROOT)
+            {
+                uint32_t f = fail[parent[s]];
+                uint32_t child;
+
+                while ((child = Goto(f, label[s])) == ROOT && f != ROOT)
+                    f = fail[f];
+
+                fail[s] = child;
+            }
+
+            output[s] = isPattern[fail[s]] ? fail[s] : output[fail[s]];
+        }
+
+        // Give every byte of the words a class of its own
+        bool inWord[256] = {};
+
+        for (uint32_t s = 1; s < numStates; s++)
+            inWord[label[s]] = true;
+
+        for (int c = 0; c < 256; c++)
+        {
+            if (inWord[c])
+                byteClass[c] = (uint8_t) numClasses++;
+        }
+
+        // When the words use every byte, no byte is left for class 0
+        if (numClasses > 256)
+        {
+            for (int c = 0; c < 256; c++)
+                byteClass[c] = (uint8_t) c;
+
+            numClasses = 256;
+        }
+
+        while ((1u << rowShift) < numClasses)
+            rowShift++;
+
+        // Fill the rows of the dense states; a missing child takes the transition of the failure link,
+        // whose row is complete already
+        this->denseStates = std::max(1u, std::min(denseStates, numStates));
+        table.resize((size_t) this->denseStates << rowShift);
+
+        for (uint32_t s = 0; s < this->denseStates; s++)
+        {
+            uint32_t* row = &table[(size_t) s << rowShift];
+
+            for (uint32_t c = 0; c < numClasses; c++)
+                row[c] = (s == ROOT) ? ROOT : table[((size_t) fail[s] << rowShift) + c];
+
+            for (uint32_t child = firstChild[s]; child < firstChild[s + 1]; child++)
+                row[byteClass[label[child]]] = Entry(child);
+        }
+
+        for (uint32_t child = firstChild[ROOT]; child < firstChild[ROOT + 1]; child++)
+            startsWord[label[child]] = true;
+    }
+
+    ~AhoCorasick() {}
+
+    /**
+     * @brief The Scan() function feeds the next chunk of a stream to the automaton, and reports every word
+     *      that ends within the chunk, including words that started in earlier chunks.
+     * @param chunk The next bytes of the stream
+     * @param callback Receives every match
+     */
+    void Scan(std::string_view chunk, const MatchCallback& callback)
+    {
+        const uint8_t* text = (const uint8_t*) chunk.data();
+        const uint32_t* rows = table.data();
+        size_t n = chunk.size();
+        uint32_t s = state;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            // At the root, the bytes that start no word lead back to the root. Checking them does not wait
+            // on the previous transition, so they are skipped several at a time
+            if (s == ROOT)
+            {
+                while (i < n && !startsWord[text[i]])
+                    i++;
+
+                if (i == n)
+                    break;
+            }
+
+            // Fast path: the next state reports nothing; the marked entries are all >= SLOW
+            uint32_t entry = (s < denseStates) ? rows[((size_t) s << rowShift) + byteClass[text[i]]] : Next(s, text[i]);
+
+            if (entry < SLOW)
+            {
+                s = entry;
+                continue;
+            }
+
+            s = entry & ~SLOW;
+
+            if (isPattern[s] || output[s] != NONE)
+                Report(s, position + i + 1, callback);
+        }
+
+        state = s;
+        position += n;
+    }
+
+    /**
+     * @brief The Reset() function starts a new stream.
+     */
+    void Reset()
+    {
+        state = ROOT;
+        position = 0;
+    }
+
+    /**
+     * @brief The Pattern() function spells out the word reported with a match.
+     * @param pattern The id of the word
+     * @return Returns the word
+     */
+    std::string Pattern(uint32_t pattern) const
+    {
+        std::string word(depth.at(pattern), '\0');
+
+        for (uint32_t s = pattern; s != ROOT; s = parent[s])
+            word[depth[s] - 1] = (char) label[s];
+
+        return word;
+    }
+
+    /**
+     * @return Returns the number of bytes scanned since the stream started
+     */
+    uint64_t Position() const
+    {
+        return position;
+    }
+
+    /**
+     * @return Returns the number of words the automaton looks for
+     */
+    uint32_t PatternCount() const
+    {
+        return numPatterns;
+    }
+
+    /**
+     * @return Returns the number of states, the root included
+     */
+    uint32_t StateCount() const
+    {
+        return (uint32_t) parent.size();
+    }
+
+    /**
+     * @return Returns the number of states with a dense row of transitions
+     */
+    uint32_t DenseStateCount() const
+    {
+        return denseStates;
+    }
+
+    /**
+     * @return Returns the bytes allocated by the automaton
+     */
+    size_t MemoryUsage() const
+    {
+        return table.capacity() * sizeof(uint32_t) + firstChild.capacity() * sizeof(uint32_t) +
+            label.capacity() + parent.capacity() * sizeof(uint32_t) + fail.capacity() * sizeof(uint32_t) +
+            output.capacity() * sizeof(uint32_t) + depth.capacity() * sizeof(uint32_t) + isPattern.capacity();
+    }
+
+};
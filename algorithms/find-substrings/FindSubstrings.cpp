@@ -1,3 +1,5 @@
+#include <random>
+
 #include "FindSubstrings.h"
 
 /**
@@ -6,6 +8,62 @@
  * @brief Funcional implementation of the Substrings algorithm
  */
 
+/**
+ * @brief The StreamSubstrings() function finds every unique substring of a string and streams them to a
+ *      callback in groups that share the same number of occurences.
+ */
+void Substrings::StreamSubstrings(std::string& S, int minCount, int minLength, const GroupCallback& callback)
+{
+    int len = S.length();                           // The length of the given string
+
+    if (len == 0)
+        return;
+
+    SuffixArray suffixArray(S);
+    const std::vector<int>& sa = suffixArray.GetSa();
+    const std::vector<int>& lcp = suffixArray.GetLcpArray();
+    std::string_view text(S);
+
+    // Lengths (shortest, longest] of the prefixes of the suffix at 'rank' occur 'count' times
+    auto emit = [&](int rank, int shortest, int longest, int count)
+    {
+        shortest = std::max(shortest, minLength - 1);
+
+        if (count >= minCount && longest > shortest)
+            callback(text.substr(sa[rank], longest), shortest + 1, count);
+    };
+
+    // Every suffix alone owns the prefixes it shares with neither neighbour
+    for (int i = 0; i < len; i++)
+    {
+        int shared = std::max(lcp[i], i + 1 < len ? lcp[i + 1] : 0);
+        emit(i, shared, len - sa[i], 1);
+    }
+
+    // Every LCP interval owns the prefixes longer than those of its enclosing interval. The stack holds
+    // the open intervals as (lcp, left bound), with strictly increasing lcp values.
+    std::vector<std::pair<int, int>> open = { { 0, 0 } };
+
+    for (int i = 1; i <= len; i++)
+    {
+        int current = i < len ? lcp[i] : 0;
+        int left = i - 1;
+
+        while (current < open.back().first)
+        {
+            std::pair<int, int> interval = open.back();
+            open.pop_back();
+
+            int parent = std::max(current, open.back().first);
+            emit(interval.second, parent, interval.first, i - interval.second);
+            left = interval.second;
+        }
+
+        if (current > open.back().first)
+            open.emplace_back(current, left);
+    }
+}
+
 /**
  * @brief The FindSubstrings() function takes in a string, finds every unique substring, and counts the
  *      number of times each substring occurs within the string.
@@ -13,46 +71,16 @@
 std::map<std::string, int> Substrings::FindSubstrings(std::string& S, int& totalSubstrings)
 {
     std::map<std::string, int> ssMap = {};          // Map of substrings and their number of occurences
-    int len = S.length();                           // The length of the given string
 
-    // Iterate over the string starting from each letter
-    for (int i = 0; i < len; i++)
+    // Write out every prefix of every group
+    StreamSubstrings(S, 1, 1, [&](std::string_view substring, int shortest, int count)
     {
-        // Iterate over each additional letter until we reach the length of the string
-        for (int j = 1; j <= len ; j++)
+        for (int length = shortest; length <= (int) substring.size(); length++)
         {
-            std::string ss = S.substr(i, j);
-                
-            // Check if we already have a key in our map for a given substring
-            auto exists = ssMap.find(ss);
-
-            // If it doesn't exist, find the number of occurences in the string
-            if (exists == ssMap.end())
-            {
-                int occurences = 0;
-                int ssLen = ss.length();
-
-                // Iterate over the string, so long as we don't exceed the length of the string, given our 
-                // substring's length as we compare
-                for (int k = 0; k < len; k++)
-                {
-                    // Break if we're out of bounds
-                    if (ssLen + k > len)
-                        break;
-
-                    std::string match = S.substr(k, ssLen);
-
-                    // Check if our current substring matches the substring we're comparing it to
-                    if (match == ss)
-                        occurences++;
-                }
-
-                // Add the substring and number of occurences to the map
-                ssMap.emplace(ss, occurences);
-                totalSubstrings++;
-            }
+            ssMap.emplace(std::string(substring.substr(0, length)), count);
+            totalSubstrings++;
         }
-    }
+    });
 
     return ssMap;
 }
@@ -92,5 +120,35 @@ int main ()
     // Display result
     sub.Display(substrings, totalSubstrings);
 
+    // Stream only the repeated substrings of at least 2 letters, without building the map
+    std::cout << "\nRepeated substrings of length 2 or more:" << std::endl;
+
+    sub.StreamSubstrings(S, 2, 2, [](std::string_view substring, int shortest, int count)
+    {
+        for (int length = shortest; length <= (int) substring.size(); length++)
+            std::cout << count << ": " << substring.substr(0, length) << std::endl;
+    });
+
+    // Count the substrings of a longer text group by group
+    std::mt19937 rng(42);
+    std::string longText(200000, 'a');
+
+    for (char& letter : longText)
+        letter = 'a' + rng() % 4;
+
+    long long distinct = 0;
+    long long repeated = 0;
+
+    sub.StreamSubstrings(longText, 1, 1, [&](std::string_view substring, int shortest, int count)
+    {
+        distinct += substring.size() - shortest + 1;
+
+        if (count > 1)
+            repeated += substring.size() - shortest + 1;
+    });
+
+    std::cout << "\nText of " << longText.length() << " letters: " << distinct << " distinct substrings, " 
+        << repeated << " of them repeated" << std::endl;
+
     return 0;
 }
\ No newline at end of file
@@ -1,26 +1,32 @@
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <functional>
 #include <algorithm>
 #include <iostream>
 
+#include "../../data-structures/suffix-array/SuffixArray.h"
+
 /**
  * @file FindSubstrings.h
  * @author 0xChristopher
  * @brief This algorithm is used to find all substrings of a given strings and the number of time they occur
  *      within said string. First, any spaces from the string in case the string in question is a phrase
- *      and not just a word, which is done prior to executing the algorithm. Upon entering the algorithm, it
- *      looks at each letter of the string, then each letter occuring thereafter, adding each one to the
- *      initial letter. A check is performed to see if a possible substring has already been computed, and
- *      if it has, the algorithm skips it.
+ *      and not just a word, which is done prior to executing the algorithm.
  * 
- *      On each iteration for new substrings, it then compares the current substring in-place to a substring 
- *      of matching size until the boundary of the string is reached. On each match, the 'occurences' 
- *      variable is updated, and after all possible matches are checked, the substring is added to the map 
- *      which is then returned at the end of the function.
+ *      Rather than building and counting every substring on its own, the algorithm builds the Suffix Array
+ *      and LCP Array of the string (see SuffixArray.h). Every occurrence of a substring is the prefix of a
+ *      suffix, and the suffixes that share a prefix are adjacent in the Suffix Array, so the number of
+ *      occurrences of a substring is the size of its block of suffixes. A single left to right pass over the
+ *      LCP Array with a stack finds every such block (an LCP interval) together with the range of prefix
+ *      lengths that own it, and each suffix covers the lengths that no other suffix shares. Substrings are
+ *      therefore streamed in groups: the prefixes of one substring whose lengths fall within a range, which
+ *      all occur the same number of times. Groups that occur too rarely or whose substrings are too short
+ *      can be filtered out before anything is built.
  * 
- *      Time Complexity: O(n*m*k) where n is the number of letters in the string, m is the remaining letters
- *          in the string to create substrings with, and k is the number of comparisons per substring.
+ *      Time Complexity: O(n) to build the arrays and stream every group, plus the size of the output when
+ *          every substring is written out
  *      Space Complexity: O(n)
  */
 
@@ -28,6 +34,22 @@ class Substrings
 {
 
     public:
+    /**
+     * @brief Called once per group of substrings: every prefix of 'substring' whose length is at least
+     *      'shortest' occurs 'count' times. The view points into the analyzed string.
+     */
+    using GroupCallback = std::function<void(std::string_view substring, int shortest, int count)>;
+
+    /**
+     * @brief The StreamSubstrings() function finds every unique substring of a string and streams them to a
+     *      callback in groups that share the same number of occurences.
+     * @param S The string to have its substrings computed
+     * @param minCount Groups occuring fewer times than this are skipped
+     * @param minLength Substrings shorter than this are skipped
+     * @param callback Receives every group of substrings
+     */
+    void StreamSubstrings(std::string& S, int minCount, int minLength, const GroupCallback& callback);
+
     /**
      * @brief The FindSubstrings() function takes in a string, finds every unique substring, and counts the
      *      number of times each substring occurs within the string.
@@ -45,4 +67,4 @@ class Substrings
      */
     void Display(std::map<std::string, int>& substrings, int totalSubstrings);
 
-};
\ No newline at end of file
+};
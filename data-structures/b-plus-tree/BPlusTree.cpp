@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <math.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <typeinfo>
+#include <algorithm>
+#include <type_traits>
+
+#include "BPlusTree.h"
+#include "../balanced-tree/AVLTree.h"
+#include "../binary-search-tree/BinarySearchTree.h"
+
+/**
+ * @file BPlusTree.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the BPlusTree class, and a benchmark of inserts, point lookups and
+ *      range scans against AVLTree and BinarySearchTree
+ */
+
+std::vector<int> data = {5, 3, 2, 7, 12, 6, 13, 24, 23, 11, 15, 9, 1, 30, 18};   // Keys to add
+int removeKey = 12;                                                             // Key to remove
+static int benchmarkKeys = 1000000;                                             // Keys in the benchmark
+static int benchmarkRanges = 100000;                                            // Range scans in the benchmark
+static int rangeWidth = 200;                                                    // Width of every range scanned
+
+/**
+ * @brief The Seconds() function measures how long a function runs.
+ * @param function The function to be timed
+ * @return Returns the time in seconds
+ */
+template <typename Function>
+double Seconds(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/**
+ * @brief The Report() function prints the throughput of every operation on one tree.
+ * @param name Name of the tree
+ * @param insert Seconds taken by the inserts
+ * @param lookup Seconds taken by the lookups
+ * @param scan Seconds taken by the range scans
+ * @param scanned Keys visited by the range scans
+ */
+void Report(const char* name, double insert, double lookup, double scan, long long scanned)
+{
+    printf("%-18s insert %6.2f M/s   lookup %6.2f M/s   range scan %7.2f M keys/s (%lld keys)\n", name,
+        benchmarkKeys / insert / 1e6, benchmarkKeys / lookup / 1e6, scanned / scan / 1e6, scanned);
+}
+
+int main()
+{
+    BPlusTree<int, int, 64> small;
+
+    // Insert keys into a tree of small nodes, so that it has a few levels
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Inserting keys into a B+ Tree of " << small.LEAF_CAPACITY << " keys per leaf..." << std::endl;
+
+    for (int key : data)
+        small.Insert(key, key * 10);
+
+    std::cout << small.Size() << " keys, height " << small.Height() << std::endl;
+    std::cout << "Keys from 5 to 15: ";
+    small.ForEachInRange(5, 15, [](int key, int value) { std::cout << key << "=" << value << " "; });
+    std::cout << std::endl;
+
+    std::cout << "Removing " << removeKey << "..." << std::endl;
+    small.Remove(removeKey);
+
+    if (small.Contains(removeKey))
+        std::cout << "The tree does contain " << removeKey << std::endl;
+    else
+        std::cout << "The tree does not contain " << removeKey << std::endl;
+
+    if (small.CheckInvariant())
+        std::cout << "Tree adheres to the B+ Tree invariant." << std::endl;
+    else
+        std::cout << "Tree fails to adhere to the B+ Tree invariant." << std::endl;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Benchmark random inserts, lookups of every key, and range scans over random ranges. The keys are odd,
+    // so every range of 'rangeWidth' holds about half as many keys.
+    std::mt19937 rng(42);
+    std::vector<int> keys(benchmarkKeys), lookups, lows(benchmarkRanges);
+
+    for (int i = 0; i < benchmarkKeys; i++)
+        keys[i] = 2 * i + 1;
+
+    std::shuffle(keys.begin(), keys.end(), rng);
+    lookups = keys;
+    std::shuffle(lookups.begin(), lookups.end(), rng);
+
+    for (int& low : lows)
+        low = rng() % (2 * benchmarkKeys);
+
+    long long found = 0, scanned = 0, sum = 0;
+    auto visit = [&](int key, int) { sum += key; };
+    auto visitValue = [&](int key) { sum += key; };
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    printf("Benchmarking %d keys, %d range scans of width %d...\n", benchmarkKeys, benchmarkRanges, rangeWidth);
+
+    BPlusTree<int, int> bPlusTree;
+    double insert = Seconds([&]() { for (int key : keys) bPlusTree.Insert(key, key); });
+    double lookup = Seconds([&]() { for (int key : lookups) found += bPlusTree.Contains(key); });
+    double scan = Seconds([&]() { for (int low : lows) scanned += bPlusTree.ForEachInRange(low, low + rangeWidth - 1, visit); });
+    Report("BPlusTree:", insert, lookup, scan, scanned);
+
+    std::vector<int> sorted(keys);
+    std::sort(sorted.begin(), sorted.end());
+    double bulk = Seconds([&]() { bPlusTree.BulkLoad(sorted, sorted); });
+    lookup = Seconds([&]() { for (int key : lookups) found += bPlusTree.Contains(key); });
+    scanned = 0;
+    scan = Seconds([&]() { for (int low : lows) scanned += bPlusTree.ForEachInRange(low, low + rangeWidth - 1, visit); });
+    Report("BPlusTree (bulk):", bulk, lookup, scan, scanned);
+
+    AVLTree<int> avlTree;
+    insert = Seconds([&]() { for (int key : keys) avlTree.CheckInsert(key); });
+    lookup = Seconds([&]() { for (int key : lookups) found += avlTree.Contains(key); });
+    scanned = 0;
+    scan = Seconds([&]() { for (int low : lows) avlTree.ForEachInRange(low, low + rangeWidth - 1, [&](int key) { visitValue(key); scanned++; }); });
+    Report("AVLTree:", insert, lookup, scan, scanned);
+
+    BinarySearchTree<int> binarySearchTree;
+    insert = Seconds([&]() { for (int key : keys) binarySearchTree.Add(key); });
+    lookup = Seconds([&]() { for (int key : lookups) found += binarySearchTree.Contains(key); });
+    scanned = 0;
+    scan = Seconds([&]() { for (int low : lows) binarySearchTree.ForEachInRange(low, low + rangeWidth - 1, [&](int key) { visitValue(key); scanned++; }); });
+    Report("BinarySearchTree:", insert, lookup, scan, scanned);
+
+    printf("BPlusTree: height %d, %.1f bytes per key; %lld lookups hit (checksum %lld)\n", bPlusTree.Height(),
+        (double) bPlusTree.MemoryUsage() / benchmarkKeys, found, sum);
+
+    // The other trees print as they are cleared, which is of no interest here
+    std::cout.setstate(std::ios::failbit);
+    avlTree.Clear();
+    binarySearchTree.Clear();
+    std::cout.clear();
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
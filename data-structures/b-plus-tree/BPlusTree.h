@@ -0,0 +1,785 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BPLUSTREE_SSE2 1
+#else
+#define BPLUSTREE_SSE2 0
+#endif
+
+/**
+ * @file BPlusTree.h
+ * @author 0xChristopher
+ * @brief B+ Tree implementation, an ordered map whose nodes hold many keys each. Inner nodes hold only
+ *      separator keys and the indices of their children, and all key/value pairs live in the leaves, which
+ *      are linked to their neighbours in key order. A lookup therefore reads one node per level of a tree
+ *      that is only a few levels deep, and a range scan finds its first key once and then walks the leaves.
+ *
+ *      Nodes are NODE_BYTES large (256 by default, four cache lines) and live in two arenas, one for leaves
+ *      and one for inner nodes, where they refer to each other by 32-bit index. The keys of a node are
+ *      searched with a linear scan, four keys per SSE2 comparison when the keys are int or float, which
+ *      beats a binary search at this node size because it never mispredicts its way through the node. In
+ *      larger nodes, up to page size, a binary search first narrows the scan down to 16 keys.
+ *
+ *      An inner node with n keys has n + 1 children, and child i holds the keys k with
+ *      keys[i - 1] <= k < keys[i]. A full node is split in half as a key is inserted, except for the last
+ *      leaf when keys arrive in ascending order, which is left full. Removal frees a leaf once it is empty
+ *      and unlinks it from its parent, but doesn't merge nodes that are only partly full.
+ *
+ *      BulkLoad() builds the tree bottom up from sorted input, with full nodes and the leaves stored one
+ *      after the other in the arena, so that range scans read memory in order.
+ *
+ *      Time Complexity:
+ *              Search              O(log n)
+ *              Insert, Remove      O(log n)
+ *              Range scan          O(log n + k)        for k keys in the range
+ *              Bulk load           O(n)
+ */
+
+template <typename K, typename V, int NODE_BYTES = 256>
+
+class BPlusTree
+{
+
+    // Keys are compared with < and <=, and searched with SIMD when possible
+    static_assert(std::is_arithmetic<K>::value, "Invalid key type");
+
+    public:
+    static constexpr int LEAF_CAPACITY = (int) ((NODE_BYTES - 12) / (sizeof(K) + sizeof(V))) & ~3;
+    static constexpr int INNER_CAPACITY = (int) ((NODE_BYTES - 8) / (sizeof(K) + 4)) & ~3;
+
+    static_assert(LEAF_CAPACITY >= 4 && INNER_CAPACITY >= 4, "NODE_BYTES too small for the key and value types");
+
+    private:
+    static constexpr uint32_t NONE = UINT32_MAX;        // Missing node
+
+    /**
+     * @brief The Leaf struct holds sorted key/value pairs and the links to its neighbours.
+     */
+    struct alignas(64) Leaf
+    {
+        K keys[LEAF_CAPACITY];                          // Sorted keys, the first 'count' used
+        V values[LEAF_CAPACITY];                        // Value of every key
+        uint32_t next = NONE;                           // Leaf with the next larger keys
+        uint32_t prev = NONE;                           // Leaf with the next smaller keys
+        int count = 0;                                  // Number of keys
+    };
+
+    /**
+     * @brief The Inner struct holds sorted separator keys and one more child than keys.
+     */
+    struct alignas(64) Inner
+    {
+        K keys[INNER_CAPACITY];                         // Sorted separators, the first 'count' used
+        uint32_t children[INNER_CAPACITY + 1];          // Arena index of every child
+        int count = 0;                                  // Number of separators
+    };
+
+    std::vector<Leaf> leaves;                           // Arena of all leaves
+    std::vector<uint32_t> freeLeaves;                   // Indices of freed leaves, reused first
+    std::vector<Inner> inners;                          // Arena of all inner nodes
+    std::vector<uint32_t> freeInners;                   // Indices of freed inner nodes, reused first
+    std::vector<std::pair<uint32_t, int>> path;         // Inner nodes and child slots along the last descent
+    uint32_t root = NONE;                               // Root, a leaf when 'height' is 0
+    uint32_t first = NONE;                              // Leaf with the smallest keys
+    int height = 0;                                     // Number of inner levels above the leaves
+    size_t size = 0;                                    // Number of keys
+
+    /**
+     * @brief The Before() function compares a key of a node with the key searched for.
+     * @param nodeKey The key of the node
+     * @param key The key searched for
+     * @return Returns true if the key of the node is less than the key, or equal to it when 'orEqual' is set
+     */
+    template <bool orEqual>
+    static bool Before(K nodeKey, K key)
+    {
+        return orEqual ? !(key < nodeKey) : nodeKey < key;
+    }
+
+    /**
+     * @brief The Rank() function counts the keys of a node that are less than a key, or less than or equal
+     *      to it when 'orEqual' is set. The keys are sorted, so this is where the key belongs in the node.
+     *      A binary search narrows large nodes down to at most 16 keys, which are then compared four at a
+     *      time with SSE2 when the keys are int or float, or one at a time without branches otherwise.
+     * @param keys The keys of the node, with room for a multiple of 4
+     * @param count The number of keys
+     * @param key The key
+     * @return Returns the number of keys before the key
+     */
+    template <bool orEqual>
+    static int Rank(const K* keys, int count, K key)
+    {
+        // The rank lies within [low, low + length]
+        int low = 0;
+        int length = count;
+
+        while (length > 16)
+        {
+            int half = length / 2;
+
+            if (Before<orEqual>(keys[low + half], key))
+            {
+                low += half + 1;
+                length -= half + 1;
+            }
+            else
+            {
+                length = half;
+            }
+        }
+
+        int end = low + length;
+
+#if BPLUSTREE_SSE2
+        if constexpr (std::is_same<K, int>::value || std::is_same<K, float>::value)
+        {
+            // Start at a multiple of 4 so that no load reaches past the keys; the keys skipped over by the
+            // binary search all come before the key, and compare that way
+            for (int i = low & ~3; i < end; i += 4)
+            {
+                int mask;
+
+                // One bit per key that comes before the key
+                if constexpr (std::is_same<K, int>::value)
+                {
+                    __m128i block = _mm_loadu_si128((const __m128i*) (keys + i));
+                    __m128i needle = _mm_set1_epi32(key);
+                    __m128i before = orEqual ? _mm_cmpgt_epi32(block, needle) : _mm_cmpgt_epi32(needle, block);
+
+                    mask = _mm_movemask_ps(_mm_castsi128_ps(before));
+                    mask = orEqual ? ~mask & 15 : mask;
+                }
+                else
+                {
+                    __m128 block = _mm_loadu_ps(keys + i);
+                    __m128 needle = _mm_set1_ps(key);
+
+                    mask = _mm_movemask_ps(orEqual ? _mm_cmple_ps(block, needle) : _mm_cmplt_ps(block, needle));
+                }
+
+                if (end - i < 4)
+                    mask &= (1 << (end - i)) - 1;
+
+                // The keys are sorted, so the first block that isn't entirely before the key is the last
+                if (mask != 15)
+                    return i + (mask & 1) + (mask >> 1 & 1) + (mask >> 2 & 1);
+            }
+
+            return end;
+        }
+        else
+#endif
+        {
+            int rank = low;
+
+            for (int i = low; i < end; i++)
+                rank += Before<orEqual>(keys[i], key);
+
+            return rank;
+        }
+    }
+
+    /**
+     * @brief The NewLeaf() function takes an empty leaf from the free list, or else from the end of the arena.
+     * @return Returns the index of the leaf
+     */
+    uint32_t NewLeaf()
+    {
+        if (!freeLeaves.empty())
+        {
+            uint32_t index = freeLeaves.back();
+            freeLeaves.pop_back();
+            leaves[index] = Leaf();
+
+            return index;
+        }
+
+        leaves.emplace_back();
+
+        return (uint32_t) (leaves.size() - 1);
+    }
+
+    /**
+     * @brief The NewInner() function takes an empty inner node from the free list, or else from the end of
+     *      the arena.
+     * @return Returns the index of the inner node
+     */
+    uint32_t NewInner()
+    {
+        if (!freeInners.empty())
+        {
+            uint32_t index = freeInners.back();
+            freeInners.pop_back();
+            inners[index] = Inner();
+
+            return index;
+        }
+
+        inners.emplace_back();
+
+        return (uint32_t) (inners.size() - 1);
+    }
+
+    /**
+     * @brief The FindLeaf() function descends from the root to the leaf whose range holds a key.
+     * @param key The key
+     * @param record Whether to record the inner nodes and child slots along the way in 'path'
+     * @return Returns the index of the leaf
+     */
+    uint32_t FindLeaf(K key, bool record)
+    {
+        uint32_t node = root;
+
+        if (record)
+            path.clear();
+
+        for (int level = height; level > 0; level--)
+        {
+            const Inner& inner = inners[node];
+            int slot = Rank<true>(inner.keys, inner.count, key);
+
+            if (record)
+                path.emplace_back(node, slot);
+
+            node = inner.children[slot];
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief The InsertIntoParents() function adds a new node to the right of the last node on 'path',
+     *      splitting the inner nodes on the way up while they are full.
+     * @param separator The smallest key of the new node
+     * @param child The new node
+     */
+    void InsertIntoParents(K separator, uint32_t child)
+    {
+        for (int level = (int) path.size() - 1; level >= 0; level--)
+        {
+            uint32_t node = path[level].first;
+            int slot = path[level].second;
+            Inner& inner = inners[node];
+
+            if (inner.count < INNER_CAPACITY)
+            {
+                std::copy_backward(inner.keys + slot, inner.keys + inner.count, inner.keys + inner.count + 1);
+                std::copy_backward(inner.children + slot + 1, inner.children + inner.count + 1,
+                    inner.children + inner.count + 2);
+                inner.keys[slot] = separator;
+                inner.children[slot + 1] = child;
+                inner.count++;
+
+                return;
+            }
+
+            // Lay out the full node with the new separator, then give the upper half to a new node and
+            // pass the middle separator on to the parent
+            K keys[INNER_CAPACITY + 1];
+            uint32_t children[INNER_CAPACITY + 2];
+
+            std::copy(inner.keys, inner.keys + slot, keys);
+            std::copy(inner.keys + slot, inner.keys + INNER_CAPACITY, keys + slot + 1);
+            std::copy(inner.children, inner.children + slot + 1, children);
+            std::copy(inner.children + slot + 1, inner.children + INNER_CAPACITY + 1, children + slot + 2);
+            keys[slot] = separator;
+            children[slot + 1] = child;
+
+            int half = (INNER_CAPACITY + 1) / 2;
+            uint32_t right = NewInner();
+            Inner& left = inners[node];
+            Inner& upper = inners[right];
+
+            std::copy(keys, keys + half, left.keys);
+            std::copy(children, children + half + 1, left.children);
+            left.count = half;
+            std::copy(keys + half + 1, keys + INNER_CAPACITY + 1, upper.keys);
+            std::copy(children + half + 1, children + INNER_CAPACITY + 2, upper.children);
+            upper.count = INNER_CAPACITY - half;
+
+            separator = keys[half];
+            child = right;
+        }
+
+        // The root was split, so the tree grows a level
+        uint32_t newRoot = NewInner();
+        Inner& inner = inners[newRoot];
+
+        inner.keys[0] = separator;
+        inner.children[0] = root;
+        inner.children[1] = child;
+        inner.count = 1;
+        root = newRoot;
+        height++;
+    }
+
+    /**
+     * @brief The RemoveFromParents() function unlinks the child at the end of 'path' from its parent, and
+     *      frees the inner nodes on the way up that are left without children.
+     */
+    void RemoveFromParents()
+    {
+        for (int level = (int) path.size() - 1; level >= 0; level--)
+        {
+            uint32_t node = path[level].first;
+            int slot = path[level].second;
+            Inner& inner = inners[node];
+
+            if (inner.count == 0)
+            {
+                freeInners.push_back(node);
+                continue;
+            }
+
+            // Child 0 takes over the range of the removed separator, children further right the range of
+            // the separator on their left
+            int key = std::max(slot - 1, 0);
+
+            std::copy(inner.keys + key + 1, inner.keys + inner.count, inner.keys + key);
+            std::copy(inner.children + slot + 1, inner.children + inner.count + 1, inner.children + slot);
+            inner.count--;
+
+            // Drop roots that are left with a single child
+            while (height > 0 && inners[root].count == 0)
+            {
+                freeInners.push_back(root);
+                root = inners[root].children[0];
+                height--;
+            }
+
+            return;
+        }
+
+        // Every node on the way was freed, so the tree is empty
+        root = NONE;
+        height = 0;
+    }
+
+    /**
+     * @brief The ValidateNode() function checks that the keys of a subtree are sorted and within the range
+     *      its parent gives it, and collects its leaves in order.
+     * @param node The root of the subtree
+     * @param level The number of inner levels above the leaves of the subtree
+     * @param low The smallest key allowed, if 'hasLow' is set
+     * @param high The key that every key must be less than, if 'hasHigh' is set
+     * @param order Receives the leaves of the subtree from left to right
+     * @return Returns true if the subtree is valid
+     */
+    bool ValidateNode(uint32_t node, int level, K low, bool hasLow, K high, bool hasHigh,
+        std::vector<uint32_t>& order)
+    {
+        const K* keys;
+        int count;
+
+        if (level == 0)
+        {
+            keys = leaves[node].keys;
+            count = leaves[node].count;
+            order.push_back(node);
+
+            if (count == 0)
+                return false;
+        }
+        else
+        {
+            keys = inners[node].keys;
+            count = inners[node].count;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((i > 0 && !(keys[i - 1] < keys[i])) || (hasLow && keys[i] < low) || (hasHigh && !(keys[i] < high)))
+                return false;
+        }
+
+        if (level == 0)
+            return true;
+
+        for (int i = 0; i <= count; i++)
+        {
+            bool childHasLow = hasLow || i > 0;
+            bool childHasHigh = hasHigh || i < count;
+            K childLow = (i > 0) ? keys[i - 1] : low;
+            K childHigh = (i < count) ? keys[i] : high;
+
+            if (!ValidateNode(inners[node].children[i], level - 1, childLow, childHasLow, childHigh, childHasHigh,
+                order))
+                return false;
+        }
+
+        return true;
+    }
+
+    public:
+    /**
+     * @brief Default constructor/destructor
+     */
+    BPlusTree()
+    {
+
+    }
+
+    ~BPlusTree()
+    {
+
+    }
+
+    /**
+     * @brief The Insert() function adds a key with its value, or replaces the value if the key exists.
+     * @param key The key
+     * @param value The value
+     * @return Returns true if the key is new
+     */
+    bool Insert(K key, V value)
+    {
+        if (root == NONE)
+        {
+            root = first = NewLeaf();
+            height = 0;
+        }
+
+        uint32_t index = FindLeaf(key, true);
+        Leaf* leaf = &leaves[index];
+        int pos = Rank<false>(leaf->keys, leaf->count, key);
+
+        if (pos < leaf->count && leaf->keys[pos] == key)
+        {
+            leaf->values[pos] = value;
+
+            return false;
+        }
+
+        size++;
+
+        // Split a full leaf in half, or leave it full when the keys arrive in ascending order
+        if (leaf->count == LEAF_CAPACITY)
+        {
+            int keep = (pos == LEAF_CAPACITY && leaf->next == NONE) ? LEAF_CAPACITY : LEAF_CAPACITY / 2;
+            uint32_t rightIndex = NewLeaf();
+            leaf = &leaves[index];
+            Leaf& right = leaves[rightIndex];
+
+            std::copy(leaf->keys + keep, leaf->keys + LEAF_CAPACITY, right.keys);
+            std::copy(leaf->values + keep, leaf->values + LEAF_CAPACITY, right.values);
+            right.count = LEAF_CAPACITY - keep;
+            leaf->count = keep;
+
+            right.next = leaf->next;
+            right.prev = index;
+
+            if (leaf->next != NONE)
+                leaves[leaf->next].prev = rightIndex;
+
+            leaf->next = rightIndex;
+
+            if (pos > keep || (pos == keep && keep == LEAF_CAPACITY))
+            {
+                leaf = &right;
+                pos -= keep;
+            }
+
+            // The new key may become the smallest of the new leaf, so the separator is taken afterwards
+            std::copy_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            std::copy_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+            leaf->keys[pos] = key;
+            leaf->values[pos] = value;
+            leaf->count++;
+
+            InsertIntoParents(right.keys[0], rightIndex);
+
+            return true;
+        }
+
+        std::copy_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        std::copy_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+        leaf->keys[pos] = key;
+        leaf->values[pos] = value;
+        leaf->count++;
+
+        return true;
+    }
+
+    /**
+     * @brief The Remove() function removes a key and its value.
+     * @param key The key
+     * @return Returns true if the key was found and removed
+     */
+    bool Remove(K key)
+    {
+        if (root == NONE)
+            return false;
+
+        uint32_t index = FindLeaf(key, true);
+        Leaf& leaf = leaves[index];
+        int pos = Rank<false>(leaf.keys, leaf.count, key);
+
+        if (pos == leaf.count || !(leaf.keys[pos] == key))
+            return false;
+
+        std::copy(leaf.keys + pos + 1, leaf.keys + leaf.count, leaf.keys + pos);
+        std::copy(leaf.values + pos + 1, leaf.values + leaf.count, leaf.values + pos);
+        leaf.count--;
+        size--;
+
+        if (leaf.count > 0)
+            return true;
+
+        // Unlink the empty leaf from its neighbours and its parent
+        if (leaf.prev != NONE)
+            leaves[leaf.prev].next = leaf.next;
+        else
+            first = leaf.next;
+
+        if (leaf.next != NONE)
+            leaves[leaf.next].prev = leaf.prev;
+
+        freeLeaves.push_back(index);
+        RemoveFromParents();
+
+        return true;
+    }
+
+    /**
+     * @brief The Find() function looks up the value of a key.
+     * @param key The key
+     * @return Returns a pointer to the value, valid until the tree changes, or nullptr if the key is missing
+     */
+    V* Find(K key)
+    {
+        if (root == NONE)
+            return nullptr;
+
+        Leaf& leaf = leaves[FindLeaf(key, false)];
+        int pos = Rank<false>(leaf.keys, leaf.count, key);
+
+        return (pos < leaf.count && leaf.keys[pos] == key) ? &leaf.values[pos] : nullptr;
+    }
+
+    /**
+     * @brief The Contains() function checks if a key exists in the B+ Tree.
+     * @param key The key
+     * @return Returns true if the key exists
+     */
+    bool Contains(K key)
+    {
+        return Find(key) != nullptr;
+    }
+
+    /**
+     * @brief The ForEachInRange() function calls a function with every key and value in a range, in
+     *      ascending order of the keys.
+     * @param low The smallest key of the range
+     * @param high The largest key of the range
+     * @param function Called as function(key, value)
+     * @return Returns the number of keys in the range
+     */
+    template <typename Function>
+    size_t ForEachInRange(K low, K high, Function function)
+    {
+        if (root == NONE || high < low)
+            return 0;
+
+        uint32_t index = FindLeaf(low, false);
+        int pos = Rank<false>(leaves[index].keys, leaves[index].count, low);
+        size_t visited = 0;
+
+        // The leaf of 'low' may hold only smaller keys, in which case the range starts at the next leaf
+        while (index != NONE)
+        {
+            const Leaf& leaf = leaves[index];
+
+            for (; pos < leaf.count; pos++)
+            {
+                if (high < leaf.keys[pos])
+                    return visited;
+
+                function(leaf.keys[pos], leaf.values[pos]);
+                visited++;
+            }
+
+            index = leaf.next;
+            pos = 0;
+        }
+
+        return visited;
+    }
+
+    /**
+     * @brief The BulkLoad() function replaces the contents of the B+ Tree with sorted keys and their
+     *      values, building full nodes level by level from the leaves up.
+     * @param keys The keys, in strictly ascending order
+     * @param values The value of every key
+     */
+    void BulkLoad(const std::vector<K>& keys, const std::vector<V>& values)
+    {
+        if (keys.size() != values.size())
+            throw "Number of keys and values differ";
+
+        for (size_t i = 1; i < keys.size(); i++)
+        {
+            if (!(keys[i - 1] < keys[i]))
+                throw "Keys must be sorted and unique";
+        }
+
+        Clear();
+
+        if (keys.empty())
+            return;
+
+        // Fill the leaves one after the other, and remember the smallest key below every node of a level
+        std::vector<uint32_t> level, nextLevel;
+        std::vector<K> lowest, nextLowest;
+
+        leaves.reserve((keys.size() + LEAF_CAPACITY - 1) / LEAF_CAPACITY);
+
+        for (size_t start = 0; start < keys.size(); start += LEAF_CAPACITY)
+        {
+            uint32_t index = NewLeaf();
+            Leaf& leaf = leaves[index];
+            int count = (int) std::min<size_t>(LEAF_CAPACITY, keys.size() - start);
+
+            std::copy(keys.begin() + start, keys.begin() + start + count, leaf.keys);
+            std::copy(values.begin() + start, values.begin() + start + count, leaf.values);
+            leaf.count = count;
+
+            if (!level.empty())
+            {
+                leaf.prev = level.back();
+                leaves[level.back()].next = index;
+            }
+
+            level.push_back(index);
+            lowest.push_back(keys[start]);
+        }
+
+        first = level.front();
+        size = keys.size();
+
+        // Group the nodes of each level under the nodes of the next, until a single root is left
+        while (level.size() > 1)
+        {
+            nextLevel.clear();
+            nextLowest.clear();
+
+            for (size_t start = 0; start < level.size(); start += INNER_CAPACITY + 1)
+            {
+                uint32_t index = NewInner();
+                Inner& inner = inners[index];
+                int count = (int) std::min<size_t>(INNER_CAPACITY + 1, level.size() - start);
+
+                for (int i = 0; i < count; i++)
+                {
+                    inner.children[i] = level[start + i];
+
+                    if (i > 0)
+                        inner.keys[i - 1] = lowest[start + i];
+                }
+
+                inner.count = count - 1;
+                nextLevel.push_back(index);
+                nextLowest.push_back(lowest[start]);
+            }
+
+            level.swap(nextLevel);
+            lowest.swap(nextLowest);
+            height++;
+        }
+
+        root = level.front();
+    }
+
+    /**
+     * @brief The Clear() function removes every key, keeping the memory of the arenas.
+     */
+    void Clear()
+    {
+        leaves.clear();
+        freeLeaves.clear();
+        inners.clear();
+        freeInners.clear();
+        root = first = NONE;
+        height = 0;
+        size = 0;
+    }
+
+    /**
+     * @brief The Size() function returns the number of keys in the B+ Tree.
+     * @return Returns the number of keys
+     */
+    size_t Size()
+    {
+        return size;
+    }
+
+    /**
+     * @brief The IsEmpty() function checks if the B+ Tree contains any keys.
+     * @return Returns true if there are no keys
+     */
+    bool IsEmpty()
+    {
+        return size == 0;
+    }
+
+    /**
+     * @brief The Height() function returns the number of levels of the B+ Tree, the leaves included.
+     * @return Returns the height
+     */
+    int Height()
+    {
+        return (root == NONE) ? 0 : height + 1;
+    }
+
+    /**
+     * @brief The MemoryUsage() function returns the bytes allocated by the arenas and their free lists.
+     * @return Returns the memory footprint in bytes
+     */
+    size_t MemoryUsage()
+    {
+        return leaves.capacity() * sizeof(Leaf) + inners.capacity() * sizeof(Inner) +
+            (freeLeaves.capacity() + freeInners.capacity()) * sizeof(uint32_t) +
+            path.capacity() * sizeof(std::pair<uint32_t, int>);
+    }
+
+    /**
+     * @brief The CheckInvariant() function checks that the keys are sorted across the whole tree, that
+     *      every key lies within the range of its parent, and that the leaf links visit every leaf in order.
+     * @return Returns true if the B+ Tree is valid
+     */
+    bool CheckInvariant()
+    {
+        if (root == NONE)
+            return size == 0 && first == NONE;
+
+        std::vector<uint32_t> order;
+        size_t keys = 0;
+        K zero = K();
+
+        if (!ValidateNode(root, height, zero, false, zero, false, order))
+            return false;
+
+        uint32_t index = first;
+        uint32_t prev = NONE;
+
+        for (uint32_t expected : order)
+        {
+            if (index != expected || leaves[index].prev != prev)
+                return false;
+
+            if (prev != NONE && !(leaves[prev].keys[leaves[prev].count - 1] < leaves[index].keys[0]))
+                return false;
+
+            keys += leaves[index].count;
+            prev = index;
+            index = leaves[index].next;
+        }
+
+        return index == NONE && keys == size;
+    }
+
+};
@@ -1,18 +1,43 @@
 #include <iostream>
 #include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
 #include "AVLTree.h"
 
 /**
  * @file AVLTree.cpp
  * @author Original JAVA by William Fiset (william.alexandre.fiset@gmail.com)
  *      C++ conversion by 0xChristopher
- * @brief Functional demonstration of the AVLTree class
+ * @brief Functional demonstration of the AVLTree class, and a benchmark of insert and remove latency on a
+ *      tree of a million nodes
  */
 
 int root = 9;                                                           // Root node to add
 int rem1 = 12;                                                          // Node to remove
 int rem2 = 11;                                                          // Node to remove
 std::vector<int> data = {5, 3, 2, 7, 12, 6, 13, 24, 23, 11, 15};        // Node data vector
+static int benchmarkNodes = 1000000;                                    // Nodes in the benchmark tree
+
+/**
+ * @brief The NanosecondsPerValue() function measures the average time a function takes per value.
+ * @param values The values
+ * @param function Called with every value
+ * @return Returns the average time in nanoseconds
+ */
+template <typename Function>
+double NanosecondsPerValue(const std::vector<int>& values, Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int value : values)
+        function(value);
+
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / values.size();
+}
 
 int main() 
 {
@@ -96,5 +121,32 @@ int main()
     avlTree.Clear();
     std::cout << "------------------------------------------------------" << std::endl;
 
+    // Insert a million values in random order, then remove them in another order. The second round takes
+    // its nodes from the free list the first round left behind.
+    std::mt19937 rng(42);
+    std::vector<int> inserts(benchmarkNodes), removals;
+
+    for (int i = 0; i < benchmarkNodes; i++)
+        inserts[i] = i + 1;
+
+    std::shuffle(inserts.begin(), inserts.end(), rng);
+    removals = inserts;
+    std::shuffle(removals.begin(), removals.end(), rng);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    printf("Benchmarking %d values...\n", benchmarkNodes);
+
+    for (const char* round : {"new nodes", "free list"})
+    {
+        double insert = NanosecondsPerValue(inserts, [&](int value) { avlTree.CheckInsert(value); });
+        int height = avlTree.Height();
+        double remove = NanosecondsPerValue(removals, [&](int value) { avlTree.CheckRemove(value); });
+
+        printf("%-10s insert %6.0f ns, remove %6.0f ns (height %d, %d nodes left)\n", round, insert, remove,
+            height, avlTree.Size());
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
     std::cin.get();
 }
\ No newline at end of file
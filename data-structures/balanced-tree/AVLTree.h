@@ -2,7 +2,8 @@
 
 #include <stdio.h>
 #include <typeinfo>
-#include <math.h>
+#include <iostream>
+#include <string>
 #include <algorithm>
 #include <queue>
 
@@ -18,6 +19,11 @@
  *      -1, 0, or 1, the tree is rebalanced through either left or right rotations. The AVL Tree must
  *      also adhere to the Binary Search Tree invariant, such that each node's left child is less than
  *      itself, and its right child greater.
+ *
+ *      Insert and Remove descend iteratively and keep the links they pass (the root pointer, or a child
+ *      pointer of a node) on a fixed-size stack. On the way back up, each node is updated and rebalanced in
+ *      place through its link, so rotations need no parent pointers, and the retracing stops as soon as a
+ *      subtree keeps its height. Removed nodes go to a free list and are reused by later insertions.
  * 
  *      Time Complexity (Search, Insert, Delete): O(log n)
  */
@@ -32,62 +38,111 @@ class AVLTree
         std::is_same<T, int>::value, "Invalid type");
 
     private:
+    static const int MAX_HEIGHT = 64;                   // Deeper than any AVL Tree that fits in memory
+
     int nodeCount = 0;                                  // Total number of nodes in the AVL Tree
     std::string prefix = "";                            // AVL Tree printer node prefix
     bool checkLeft = false;                             // Used in AVL Tree visual representation prefix printing
-    Node<T>* root = nullptr;                            // AVL Tree root
-    Node<T>* TOKEN = new Node<T>(-1, nullptr, nullptr); // Used to indicate duplicate values in the AVL Tree
-    Node<T>* tmp = nullptr;                             // Pointer used to delete removed nodes
+    AVLNode<T>* root = nullptr;                         // AVL Tree root
+    AVLNode<T>* freeNodes = nullptr;                    // Removed nodes kept for reuse, linked through 'left'
 
     /**
-     * @brief The Insert() function inserts a node into the AVL Tree
-     * @param node The root of the tree
-     * @param value The value of the node to be inserted
-     * @return Returns a TOKEN for duplicate node values, or returns a new Node
+     * @brief The NewNode() function takes a node from the free list, or allocates one if the list is empty.
+     * @param value The value of the node
+     * @return Returns the node, without children
      */
-    Node<T>* Insert(Node<T>*& node, T value) 
+    AVLNode<T>* NewNode(T value) 
     {
-        if (node == nullptr)
-            return new Node<T>(value, nullptr, nullptr);
+        if (freeNodes == nullptr)
+            return new AVLNode<T>(value, nullptr, nullptr);
+
+        AVLNode<T>* node = freeNodes;
+        freeNodes = node->left;
+        *node = AVLNode<T>(value, nullptr, nullptr);
+
+        return node;
+    }
 
-        if (value < node->value) 
+    /**
+     * @brief The FreeNode() function puts a node on the free list.
+     * @param node The node
+     */
+    void FreeNode(AVLNode<T>* node) 
+    {
+        node->left = freeNodes;
+        freeNodes = node;
+    }
+
+    /**
+     * @brief The Retrace() function updates and rebalances the nodes along a path from the bottom up, and
+     * stops as soon as a subtree keeps its height, since nothing above it changes then. The path holds the
+     * links to the nodes rather than the nodes, so a rotation replaces the subtree in its parent directly.
+     * @param path The links from the root down to the parent of the changed subtree
+     * @param depth The number of links in the path
+     */
+    void Retrace(AVLNode<T>** path[], int depth) 
+    {
+        while (depth > 0) 
         {
-            Node<T>* newLeftNode = Insert(node->left, value);
+            AVLNode<T>** link = path[--depth];
+            int oldHeight = (*link)->height;
 
-            if (newLeftNode == TOKEN)
-                return TOKEN;
+            Update(*link);
+            *link = Balance(*link);
 
-            node->left = newLeftNode;
-        } 
-        else if (value > node->value) 
+            if ((*link)->height == oldHeight)
+                return;
+        }
+    }
+
+    /**
+     * @brief The Insert() function inserts a node into the AVL Tree, descending iteratively and keeping
+     * the links it passes on a stack for the way back up.
+     * @param value The value of the node to be inserted
+     * @return Returns false for duplicate node values, or true once the node is inserted
+     */
+    bool Insert(T value) 
+    {
+        AVLNode<T>** path[MAX_HEIGHT];
+        AVLNode<T>** link = &root;
+        int depth = 0;
+
+        while (*link != nullptr) 
         {
-            Node<T> *newRightNode = Insert(node->right, value);
+            AVLNode<T>* node = *link;
 
-            if (newRightNode == TOKEN)
-                return TOKEN;
+            if (value < node->value) 
+            {
+                path[depth++] = link;
+                link = &node->left;
+            } 
+            else if (value > node->value) 
+            {
+                path[depth++] = link;
+                link = &node->right;
+            } 
+            else
+                return false;
+        }
 
-            node->right = newRightNode;
-        } 
-        else
-            return TOKEN;
+        *link = NewNode(value);
 
-        // Update node balance factor and height
-        Update(node);
-        
         // Rebalance tree
-        return Balance(node);
+        Retrace(path, depth);
+
+        return true;
     }
 
     /**
      * @brief The Update() function updates a node's height and balance factor.
      * @param node The node to be updated
      */
-    void Update(Node<T>*& node) 
+    void Update(AVLNode<T>* node) 
     {
         int leftNodeHeight = (node->left == nullptr) ? -1 : node->left->height;
         int rightNodeHeight = (node->right == nullptr) ? -1 : node->right->height;
 
-        node->height = 1 + fmax(leftNodeHeight, rightNodeHeight);
+        node->height = 1 + std::max(leftNodeHeight, rightNodeHeight);
         node->bf = rightNodeHeight - leftNodeHeight;
     }
 
@@ -97,7 +152,7 @@ class AVLTree
      * @param node The node to be rebalanced
      * @return Returns the re-balanced node
      */
-    Node<T>* Balance(Node<T>*& node) 
+    AVLNode<T>* Balance(AVLNode<T>* node) 
     {
         // Left heavy subtree
         if (node->bf == -2) 
@@ -123,23 +178,23 @@ class AVLTree
     }
 
     /****** Tree Rotations ******/
-    Node<T>* LeftLeftCase(Node<T>*& node) 
+    AVLNode<T>* LeftLeftCase(AVLNode<T>* node) 
     {
         return RightRotation(node);
     }
 
-    Node<T>* LeftRightCase(Node<T>*& node) 
+    AVLNode<T>* LeftRightCase(AVLNode<T>* node) 
     {
         node->left = LeftRotation(node->left);
         return LeftLeftCase(node);
     }
 
-    Node<T>* RightRightCase(Node<T>*& node) 
+    AVLNode<T>* RightRightCase(AVLNode<T>* node) 
     {
         return LeftRotation(node);
     }
 
-    Node<T>* RightLeftCase(Node<T>*& node) 
+    AVLNode<T>* RightLeftCase(AVLNode<T>* node) 
     {
         node->right = RightRotation(node->right);
         return RightRightCase(node);
@@ -150,9 +205,9 @@ class AVLTree
      * @param node The node to be rotated
      * @return Returns the new parent node
      */
-    Node<T>* LeftRotation(Node<T>*& node) 
+    AVLNode<T>* LeftRotation(AVLNode<T>* node) 
     {
-        Node<T>* newParent = node->right;
+        AVLNode<T>* newParent = node->right;
         node->right = newParent->left;
         newParent->left = node;
 
@@ -167,9 +222,9 @@ class AVLTree
      * @param node The node to be rotated
      * @return Returns the new parent node
      */
-    Node<T>* RightRotation(Node<T>*& node) 
+    AVLNode<T>* RightRotation(AVLNode<T>* node) 
     {
-        Node<T>* newParent = node->left;
+        AVLNode<T>* newParent = node->left;
         node->left = newParent->right;
         newParent->right = node;
 
@@ -180,115 +235,77 @@ class AVLTree
     }
 
     /**
-     * @brief The Remove() function removes a node from the AVL Tree.
-     * @param node The root of the AVL Tree
+     * @brief The Remove() function removes a node from the AVL Tree, descending iteratively and keeping
+     * the links it passes on a stack for the way back up.
      * @param value The value of the node to be removed
-     * @return Returns the rebalanced node upon successful removal, or TOKEN if the node doesn't exist
-     * in the tree
+     * @return Returns true upon successful removal, or false if the node doesn't exist in the tree
      */
-    Node<T>* Remove(Node<T>*& node, T value) 
+    bool Remove(T value) 
     {
-        if (node == nullptr)
-            return TOKEN;
+        AVLNode<T>** path[MAX_HEIGHT];
+        AVLNode<T>** link = &root;
+        int depth = 0;
 
-        // Node value is less than the root, so dig left
-        if (value < node->value) 
+        // Node value is less than the current node, so dig left, or greater, so dig right
+        while (*link != nullptr && (value < (*link)->value || value > (*link)->value)) 
         {
-            Node<T>* newLeftNode = Remove(node->left, value);
-
-            if (newLeftNode == TOKEN)
-                return TOKEN;
+            path[depth++] = link;
+            link = (value < (*link)->value) ? &(*link)->left : &(*link)->right;
+        }
 
-            node->left = newLeftNode;
-        } 
-        // Node value is greater than the root, so dig right
-        else if (value > node->value) 
-        {
-            Node<T>* newRightNode = Remove(node->right, value);
+        if (*link == nullptr)
+            return false;
 
-            if (newRightNode == TOKEN)
-                return TOKEN;
+        AVLNode<T>* node = *link;
 
-            node->right = newRightNode;   
+        // Swap with the only child, if any
+        if (node->left == nullptr || node->right == nullptr) 
+        {
+            *link = (node->left != nullptr) ? node->left : node->right;
+            FreeNode(node);
         } 
-        // Found the node to remove 
+        // Node has left and right subtrees: take the value of its predecessor or successor from the taller
+        // subtree, and unlink that node on the same descent
         else 
         {
-            // Swap with right child if it exists and left child is null
-            if (node->left == nullptr) 
-            {
-                tmp = node;
+            path[depth++] = link;
 
-                return node->right;
-            } 
-            // Swap with left child if it exists and right child is null
-            else if (node->right == nullptr) 
+            if (node->left->height > node->right->height) 
             {
-                tmp = node;
+                AVLNode<T>** successor = &node->left;
 
-                return node->left;
+                while ((*successor)->right != nullptr) 
+                {
+                    path[depth++] = successor;
+                    successor = &(*successor)->right;
+                }
+
+                AVLNode<T>* replacement = *successor;
+                node->value = replacement->value;
+                *successor = replacement->left;
+                FreeNode(replacement);
             } 
-            // Node has left and right subtrees or no subtrees
             else 
             {
-                // Remove from the left subtree
-                if (node->left->height > node->right->height) 
-                {
-                    T successorValue = FindMax(node->left);
-                    node->value = successorValue;
-                    Node<T>* replacement = Remove(node->left, successorValue);
-
-                    if (replacement == TOKEN)
-                        return TOKEN;
-                    
-                    node->left = replacement;
-                } 
-                // Remove from the right subtree
-                else 
-                {
-                    T successorValue = FindMin(node->right);
-                    node->value = successorValue;
-                    Node<T>* replacement = Remove(node->right, successorValue);
-
-                    if (replacement == TOKEN)
-                        return TOKEN;
+                AVLNode<T>** successor = &node->right;
 
-                    node->right = replacement;
+                while ((*successor)->left != nullptr) 
+                {
+                    path[depth++] = successor;
+                    successor = &(*successor)->left;
                 }
+
+                AVLNode<T>* replacement = *successor;
+                node->value = replacement->value;
+                *successor = replacement->right;
+                FreeNode(replacement);
             }
         }
 
-        // Update node balance factor and height
-        Update(node);
-        
         // Rebalance tree
-        return Balance(node);
-    }
+        Retrace(path, depth);
 
-    /**
-     * @brief The FindMin() function finds the minimum value in the tree or subtree.
-     * @param node The node to begin searching from
-     * @return Returns the value of the smallest node in the given subtree
-     */
-    T FindMin(Node<T>*& node) 
-    {
-        while (node->left != nullptr)
-            node = node->left;
-
-        return node->value;
-    }
-
-    /**
-     * @brief The FindMax() function finds the maximum value in the tree or subtree.
-     * @param node The node to begin searching from
-     * @return Returns the value of the largest node in the given subtree
-     */
-    T FindMax(Node<T>*& node) 
-    {
-        while (node->right != nullptr)
-            node = node->right;
-
-        return node->value;
+        return true;
     }
 
     /**
@@ -298,7 +315,7 @@ class AVLTree
      * @param node The root of the tree or subtree to be tested
      * @return Returns true if the AVL Tree ahears to the invariant
      */
-    bool ValidateBSTInvariant(Node<T>* node) 
+    bool ValidateBSTInvariant(AVLNode<T>* node) 
     {
         if (node == nullptr)
             return true;
@@ -315,6 +332,30 @@ class AVLTree
         return isValid && ValidateBSTInvariant(node->left) && ValidateBSTInvariant(node->right);
     }
 
+    /**
+     * @brief The InRange() function visits the values of a subtree that lie within a range, in ascending
+     * order, skipping the subtrees that lie entirely outside of it.
+     * @param node The root of the subtree
+     * @param low The smallest value of the range
+     * @param high The largest value of the range
+     * @param function Called with every value in the range
+     */
+    template <typename Function>
+    void InRange(AVLNode<T>* node, T low, T high, Function& function) 
+    {
+        if (node == nullptr)
+            return;
+
+        if (low < node->value)
+            InRange(node->left, low, high, function);
+
+        if (!(node->value < low) && !(high < node->value))
+            function(node->value);
+
+        if (node->value < high)
+            InRange(node->right, low, high, function);
+    }
+
     /**
      * @brief The PrintAVLTree() function displays a visual representation of the current state of the AVL
      * tree via reversed pre-order traversal.
@@ -322,7 +363,7 @@ class AVLTree
      * @param node The node to begin traversal from (typically the root of the tree)
      * @param checkLeft Determines which string gets appended to the prefix
      */
-    void PrintAVLTree(const std::string& prefix, Node<T>*& node, bool checkLeft) 
+    void PrintAVLTree(const std::string& prefix, AVLNode<T>*& node, bool checkLeft) 
     {
         if (node == nullptr)
             return;
@@ -340,17 +381,17 @@ class AVLTree
      * via level order traversal.
      * @param node The root node to begin traversal from (typically the root of the tree)
      */
-    void DisplayNodes(Node<T>*& node) 
+    void DisplayNodes(AVLNode<T>*& node) 
     {
         if (node == nullptr)
             return;
 
-        std::queue<Node<T>*> nodes;
+        std::queue<AVLNode<T>*> nodes;
         nodes.emplace(node);
 
         while (nodes.empty() == false) 
         {
-            Node<T>* node = nodes.front();
+            AVLNode<T>* node = nodes.front();
 
             printf("%d ", node->value);
             nodes.pop();
@@ -365,24 +406,23 @@ class AVLTree
 
     /**
      * @brief The ClearTree() function iterates over the AVL Tree via level order traversal utilizing
-     * the nodes queue, simultaneously storing each node in the removal queue to be deleted.
+     * the nodes queue, moving each node to the free list once its children are queued.
      * @param node The node to begin the traversal from (typically the root of the AVL Tree)
+     * @return Returns the number of nodes removed
      */
-    void ClearTree(Node<T>*& node) 
+    int ClearTree(AVLNode<T>* node) 
     {
         if (node == nullptr)
-            return;
+            return 0;
 
-        std::queue<Node<T>*> nodes;
-        std::queue<Node<T>*> removal;
+        std::queue<AVLNode<T>*> nodes;
+        int nodesRemoved = 0;
         nodes.emplace(node);
 
         // Begin level order traversal
         while (!nodes.empty()) 
         {
-            Node<T>* node = nodes.front();
-            removal.emplace(node);
-
+            AVLNode<T>* node = nodes.front();
             nodes.pop();
 
             if (node->left != nullptr)
@@ -390,20 +430,12 @@ class AVLTree
 
             if (node->right != nullptr)
                 nodes.emplace(node->right);
-        }
 
-        int nodesRemoved = 0;
-
-        // Deallocate Node memory utilizing removal queue 
-        while (!removal.empty()) 
-        {
-            delete removal.front();
-
-            removal.pop();
+            FreeNode(node);
             nodesRemoved++;
         }
 
-        std::cout << nodesRemoved << " nodes removed." << std::endl;
+        return nodesRemoved;
     }
 
     public:
@@ -417,7 +449,16 @@ class AVLTree
 
     ~AVLTree() 
     {
-        delete TOKEN;
+        ClearTree(root);
+
+        // Deallocate Node memory utilizing the free list
+        while (freeNodes != nullptr) 
+        {
+            AVLNode<T>* node = freeNodes;
+            freeNodes = node->left;
+
+            delete node;
+        }
     }
 
     /**
@@ -457,7 +498,7 @@ class AVLTree
      */
     bool Contains(T value) 
     {
-        Node<T>* node = root;
+        AVLNode<T>* node = root;
 
         while (node != nullptr) 
         {
@@ -472,6 +513,18 @@ class AVLTree
         return false;
     }
 
+    /**
+     * @brief The ForEachInRange() function calls a function with every value in a range, in ascending order.
+     * @param low The smallest value of the range
+     * @param high The largest value of the range
+     * @param function Called with every value in the range
+     */
+    template <typename Function>
+    void ForEachInRange(T low, T high, Function function) 
+    {
+        InRange(root, low, high, function);
+    }
+
     /**
      * @brief The CheckInsert() function checks to see if a node was successfully inserted.
      * @param value The value of the node to be inserted
@@ -482,14 +535,10 @@ class AVLTree
         if (!value)
             return false;
 
-        Node<T>* newRoot = Insert(root, value);
-        bool insertedNode = (newRoot != TOKEN);
+        bool insertedNode = Insert(value);
 
-        if (insertedNode) 
-        {
-            root = newRoot;
+        if (insertedNode)
             nodeCount++;
-        }
 
         return insertedNode;
     }
@@ -501,18 +550,12 @@ class AVLTree
      */
     bool CheckRemove(T elem) 
     {
-        Node<T>* newRoot = Remove(root, elem);
-        bool removedNode = (newRoot != TOKEN) || (newRoot == nullptr);
+        bool removedNode = Remove(elem);
 
-        if (removedNode) 
-        {
-            delete tmp;
+        if (removedNode)
             nodeCount--;
 
-            return true;
-        }
-
-        return false;
+        return removedNode;
     }
 
     /** 
@@ -548,7 +591,12 @@ class AVLTree
      */
     void Clear() 
     {
-        ClearTree(root);
+        int nodesRemoved = ClearTree(root);
+
+        root = nullptr;
+        nodeCount = 0;
+
+        std::cout << nodesRemoved << " nodes removed." << std::endl;
     }
 
 };
\ No newline at end of file
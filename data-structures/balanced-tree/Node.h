@@ -1,17 +1,18 @@
 #pragma once
 
-#include <iostream>
+#include <type_traits>
 
 /**
  * @file Node.h
  * @author Original JAVA by William Fiset (william.alexandre.fiset@gmail.com)
  *         C++ conversion by 0xChristopher
- * @brief The Node struct contains the Node variables and pointers.
+ * @brief The AVLNode class contains the node variables and pointers of an AVLTree. It has a name of its
+ *      own, so that it can be used alongside the Node of BinarySearchTree.
  */
 
 template <typename T>
 
-class Node {
+class AVLNode {
     
     template <typename U>
     friend class AVLTree;
@@ -24,29 +25,26 @@ class Node {
     int bf = 0;             // Balance factor
     T value;                // Node data
     int height = 0;         // Height of node within the tree
-    Node* left;             // Left child 
-    Node* right;            // Right child
+    AVLNode* left;          // Left child 
+    AVLNode* right;         // Right child
 
     public:
     /**
-     * @brief Node constructor and destructor
-     * @param value The Node data
+     * @brief AVLNode constructor and destructor
+     * @param value The node data
      * @param left Left child
      * @param right Right child
      */
-    Node(T value, Node* left, Node* right) 
+    AVLNode(T value, AVLNode* left, AVLNode* right) 
     {
         this->value = value;
         this->left = left;
         this->right = right;
     }
 
-    ~Node() 
+    ~AVLNode() 
     {
-        if (this->value == -1)
-            std::cout << "TOKEN removed" << std::endl;
-        else
-            std::cout << "Node removed" << std::endl;
+
     }
 
 };
\ No newline at end of file
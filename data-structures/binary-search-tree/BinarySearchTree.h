@@ -74,16 +74,6 @@ class BinarySearchTree
         return node;
     }
 
-    /**
-     * @brief The Contains(T elem) function returns true if the root node has a value.
-     * @param elem The node value being searched for
-     * @return Returns true or false based on the overloaded function
-     */
-    bool Contains(T elem) 
-    {
-        return Contains(root, elem);
-    }
-
     /**
      * @brief The Contains(Node<T>* node, T elem) function checks the left then right children of the
      * current node for value insertion.
@@ -235,6 +225,30 @@ class BinarySearchTree
         }
     }
 
+    /**
+     * @brief The InRange() function visits the values of a subtree that lie within a range, in ascending
+     * order, skipping the subtrees that lie entirely outside of it.
+     * @param node The root node of the BST or subtree
+     * @param low The smallest value of the range
+     * @param high The largest value of the range
+     * @param function Called with every value in the range
+     */
+    template <typename Function>
+    void InRange(Node<T>* node, T low, T high, Function& function) 
+    {
+        if (node == nullptr)
+            return;
+
+        if (low < node->m_data)
+            InRange(node->m_left, low, high, function);
+
+        if (!(node->m_data < low) && !(high < node->m_data))
+            function(node->m_data);
+
+        if (node->m_data < high)
+            InRange(node->m_right, low, high, function);
+    }
+
     /**
      * @brief The PreOrder() function prints all of the node values in the BST via pre-order traversal.
      * @param node The root node of the BST
@@ -361,6 +375,28 @@ class BinarySearchTree
         std::cout << "\nThe height of the Binary Search Tree is: " << Height(root) << std::endl;
     }
 
+    /**
+     * @brief The Contains(T elem) function returns true if the root node has a value.
+     * @param elem The node value being searched for
+     * @return Returns true or false based on the overloaded function
+     */
+    bool Contains(T elem) 
+    {
+        return Contains(root, elem);
+    }
+
+    /**
+     * @brief The ForEachInRange() function calls a function with every value in a range, in ascending order.
+     * @param low The smallest value of the range
+     * @param high The largest value of the range
+     * @param function Called with every value in the range
+     */
+    template <typename Function>
+    void ForEachInRange(T low, T high, Function function) 
+    {
+        InRange(root, low, high, function);
+    }
+
     /**
      * @brief The Add(T elem) function attempts to add an element to the BST and returns true if it
      * is successful.
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+
+#include "FMIndex.h"
+
+/**
+ * @file FMIndex.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the FM-index, comparing its size and query speed to the SuffixArray
+ *      it is built from, and querying a saved index through a memory mapping
+ */
+
+int main()
+{
+    std::string text = "abracadabra";
+    SuffixArray suffixArray(text);
+    FMIndex index(suffixArray, 4);
+
+    // Query a small text
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Text: " << text << std::endl;
+    std::cout << "Count(\"abra\"): " << index.Count("abra") << std::endl;
+    std::cout << "Locate(\"a\"): { ";
+
+    for (int position : index.Locate("a"))
+        std::cout << position << " ";
+
+    std::cout << "}" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Index a larger text and compare it with the suffix array it came from
+    int textLength = 10000000;
+    std::mt19937 rng(42);
+    std::string corpus(textLength, 'a');
+
+    for (char& letter : corpus)
+        letter = 'a' + rng() % 26;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Indexing " << textLength << " random letters..." << std::endl;
+
+    SuffixArray corpusArray(corpus);
+    FMIndex corpusIndex(corpusArray);
+
+    printf("Text %.1f MB, suffix array %.1f MB, FM-index %.1f MB\n", textLength / 1048576.0,
+        corpusArray.GetSa().size() * sizeof(int) / 1048576.0, corpusIndex.MemoryUsage() / 1048576.0);
+
+    std::vector<std::string> patterns;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        int start = rng() % (textLength - 8);
+        patterns.emplace_back(corpus.substr(start, 3 + rng() % 6));
+    }
+
+    uint64_t saMatches = 0, fmMatches = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (const std::string& pattern : patterns)
+        saMatches += corpusArray.Count(pattern);
+
+    auto middle = std::chrono::steady_clock::now();
+
+    for (const std::string& pattern : patterns)
+        fmMatches += corpusIndex.Count(pattern);
+
+    auto end = std::chrono::steady_clock::now();
+
+    printf("Count of %zu patterns: suffix array %.1f ms, FM-index %.1f ms (%llu and %llu matches)\n",
+        patterns.size(), std::chrono::duration<double, std::milli>(middle - start).count(),
+        std::chrono::duration<double, std::milli>(end - middle).count(), (unsigned long long) saMatches,
+        (unsigned long long) fmMatches);
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Save the index and query it straight out of the file
+    std::string indexPath = "corpus.fmi";         // Saved FM-index
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    corpusIndex.Save(indexPath);
+
+    auto loadStart = std::chrono::steady_clock::now();
+    FMIndex mapped(indexPath);
+    auto loadEnd = std::chrono::steady_clock::now();
+
+    std::string pattern = corpus.substr(1234, 6);
+    std::vector<int> positions = mapped.Locate(pattern);
+    std::sort(positions.begin(), positions.end());
+
+    std::cout << "Mapped the index in " << std::chrono::duration<double, std::micro>(loadEnd - loadStart).count() 
+        << " us" << std::endl;
+    std::cout << "Locate(\"" << pattern << "\"): { ";
+
+    for (int position : positions)
+        std::cout << position << " ";
+
+    std::cout << "}" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,531 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../fm-index/FMIndexFile.h"
+#include "../suffix-array/SuffixArray.h"
+
+/**
+ * @file FMIndex.h
+ * @author 0xChristopher
+ * @brief The FMIndex class is a compressed full-text index built from the output of a SuffixArray. It
+ *      keeps the Burrows-Wheeler Transform (BWT) of the text instead of the text and its 4n byte SA:
+ *
+ *      - The BWT is stored as a wavelet matrix: 8 bitvectors, one per bit of a byte, with a rank
+ *        directory every 512 bits. Counting a byte in a prefix of the BWT costs 8 rank queries.
+ *      - Backward search matches a pattern from its last character to its first, narrowing the range of
+ *        rows that start with the part matched so far, so Count() never touches the text.
+ *      - Only every 'sampleRate'-th suffix position is kept. Locate() steps every row of the range back
+ *        through the text with the LF mapping until it reaches a sampled row.
+ *
+ *      With the default sample rate the index takes about 1.3 bytes per character of text. The index lives
+ *      in one buffer laid out as described in FMIndexFile.h, so Save() writes that buffer as is, and the
+ *      path constructor memory maps a saved index and queries it in place. A mapped index is checked once
+ *      when it is opened, so that no query on a corrupt file reads outside the mapping.
+ *
+ *      NOTE: Loading an index relies on the POSIX mmap() interface.
+ *
+ *      Time Complexity:
+ *              Construction        O(n)                from a built SuffixArray
+ *              Count               O(m)                for a pattern of length m
+ *              Locate              O(m + occ * s)      where occ is the number of matches and s the sample rate
+ */
+
+class FMIndex
+{
+
+    private:
+    std::vector<uint64_t> storage;              // Index buffer when built in memory
+    int fd = -1;                                // File descriptor of a mapped index file
+    void* mapping = nullptr;                    // Start of the memory mapping
+    size_t mappingSize = 0;                     // Size of the memory mapping in bytes
+    const FMIndexFileHeader* header = nullptr;  // Index header
+    const uint64_t* levels = nullptr;           // Wavelet matrix levels, one bitvector after the other
+    const uint64_t* sampled = nullptr;          // Marks the rows whose suffix position is sampled
+    const uint32_t* samples = nullptr;          // Suffix positions of the sampled rows
+    uint64_t levelWords = 0;                    // Size of one bitvector in words
+
+    /**
+     * @brief The SetBit() function sets a bit of a bitvector under construction.
+     * @param bitvector The bitvector
+     * @param i The position of the bit
+     */
+    static void SetBit(uint64_t* bitvector, uint64_t i)
+    {
+        bitvector[i / 512 * 9 + 1 + i % 512 / 64] |= 1ULL << (i % 64);
+    }
+
+    /**
+     * @brief The BuildRanks() function fills in the rank directory of a bitvector once its bits are set.
+     * @param bitvector The bitvector
+     * @param bits The number of bits in the bitvector
+     */
+    static void BuildRanks(uint64_t* bitvector, uint64_t bits)
+    {
+        uint64_t sum = 0;
+
+        for (uint64_t block = 0; block <= bits / 512; block++)
+        {
+            uint64_t* words = bitvector + block * 9;
+            words[0] = sum;
+
+            for (int w = 1; w < 9; w++)
+                sum += __builtin_popcountll(words[w]);
+        }
+    }
+
+    /**
+     * @brief The Bit() function reads a bit of a bitvector.
+     * @param bitvector The bitvector
+     * @param i The position of the bit
+     * @return Returns the bit at position i
+     */
+    static int Bit(const uint64_t* bitvector, uint64_t i)
+    {
+        return (bitvector[i / 512 * 9 + 1 + i % 512 / 64] >> (i % 64)) & 1;
+    }
+
+    /**
+     * @brief The Rank1() function counts the set bits of a bitvector before a position.
+     * @param bitvector The bitvector
+     * @param i The position to count up to, exclusive
+     * @return Returns the number of set bits in [0, i)
+     */
+    static uint64_t Rank1(const uint64_t* bitvector, uint64_t i)
+    {
+        const uint64_t* block = bitvector + i / 512 * 9;
+        uint64_t rank = block[0];
+        int word = (int) (i % 512 / 64);
+
+        for (int w = 0; w < word; w++)
+            rank += __builtin_popcountll(block[1 + w]);
+
+        if (i % 64 != 0)
+            rank += __builtin_popcountll(block[1 + word] << (64 - i % 64));
+
+        return rank;
+    }
+
+    /**
+     * @brief The Access() function reads a byte of the BWT from the wavelet matrix.
+     * @param row The row of the BWT
+     * @return Returns the byte at the row
+     */
+    int Access(uint64_t row) const
+    {
+        int c = 0;
+
+        for (int level = 0; level < 8; level++)
+        {
+            const uint64_t* bitvector = levels + level * levelWords;
+            int bit = Bit(bitvector, row);
+            uint64_t ones = Rank1(bitvector, row);
+
+            c = (c << 1) | bit;
+            row = bit ? header->zeros[level] + ones : row - ones;
+        }
+
+        return c;
+    }
+
+    /**
+     * @brief The Rank() function counts the occurrences of a byte in a prefix of the BWT. The sentinel is
+     *      stored as a 0 byte, so it is taken back out of the count of 0.
+     * @param c The byte to be counted
+     * @param row The end of the prefix, exclusive
+     * @return Returns the number of occurrences of c in BWT[0, row)
+     */
+    uint64_t Rank(int c, uint64_t row) const
+    {
+        uint64_t start = 0;
+        uint64_t end = row;
+
+        for (int level = 0; level < 8; level++)
+        {
+            const uint64_t* bitvector = levels + level * levelWords;
+
+            if ((c >> (7 - level)) & 1)
+            {
+                start = header->zeros[level] + Rank1(bitvector, start);
+                end = header->zeros[level] + Rank1(bitvector, end);
+            }
+            else
+            {
+                start -= Rank1(bitvector, start);
+                end -= Rank1(bitvector, end);
+            }
+        }
+
+        return end - start - (c == 0 && header->sentinelRow < row);
+    }
+
+    /**
+     * @brief The Attach() function points the section pointers into an index buffer.
+     * @param base The start of the index buffer
+     */
+    void Attach(const void* base)
+    {
+        const char* bytes = (const char*) base;
+
+        header = (const FMIndexFileHeader*) bytes;
+        levelWords = FMIndexFileHeader::BitvectorWords(header->rows);
+        levels = (const uint64_t*) (bytes + header->LevelsPosition());
+        sampled = (const uint64_t*) (bytes + header->SampledPosition());
+        samples = (const uint32_t*) (bytes + header->SamplesPosition());
+    }
+
+    /**
+     * @brief The IsRankDirectoryValid() function checks that every block of a bitvector counts the set
+     *      bits before it.
+     * @param bitvector The bitvector
+     * @param bits The number of bits in the bitvector
+     * @return Returns true if the rank directory is consistent
+     */
+    static bool IsRankDirectoryValid(const uint64_t* bitvector, uint64_t bits)
+    {
+        uint64_t sum = 0;
+
+        for (uint64_t block = 0; block <= bits / 512; block++)
+        {
+            const uint64_t* words = bitvector + block * 9;
+
+            if (words[0] != sum)
+                return false;
+
+            for (int w = 1; w < 9; w++)
+                sum += __builtin_popcountll(words[w]);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief The IsValid() function checks the sections of an attached index: the rank directories, the
+     *      number of 0 bits on every level, the C counts against the byte counts of the BWT, and the
+     *      sampled suffix positions. Every row a query computes then stays within [0, rows].
+     * @return Returns true if the index is consistent
+     */
+    bool IsValid() const
+    {
+        uint64_t rows = header->rows;
+
+        for (int level = 0; level < 8; level++)
+        {
+            const uint64_t* bitvector = levels + level * levelWords;
+
+            if (!IsRankDirectoryValid(bitvector, rows) || header->zeros[level] != rows - Rank1(bitvector, rows))
+                return false;
+        }
+
+        // The sentinel is stored as a 0 byte, which Rank() takes back out of the count of 0
+        if (header->sentinelRow >= rows || Access(header->sentinelRow) != 0)
+            return false;
+
+        if (header->counts[0] != 1 || header->counts[256] != rows)
+            return false;
+
+        for (int c = 0; c < 256; c++)
+        {
+            if (header->counts[c + 1] != header->counts[c] + Rank(c, rows))
+                return false;
+        }
+
+        if (!IsRankDirectoryValid(sampled, rows) || Rank1(sampled, rows) != header->sampleCount)
+            return false;
+
+        for (uint64_t i = 0; i < header->sampleCount; i++)
+        {
+            if (samples[i] >= rows)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief The Close() function unmaps the index file and closes its file descriptor.
+     */
+    void Close()
+    {
+        if (mapping != nullptr)
+            munmap(mapping, mappingSize);
+
+        if (fd != -1)
+            close(fd);
+
+        fd = -1;
+        mapping = nullptr;
+        mappingSize = 0;
+    }
+
+    public:
+    /**
+     * @brief FMIndex constructor from a SuffixArray
+     * @param suffixArray The suffix array of the text to be indexed
+     * @param sampleRate Every suffix position divisible by sampleRate is kept for Locate()
+     */
+    FMIndex(SuffixArray& suffixArray, int sampleRate = 32)
+    {
+        if (sampleRate <= 0)
+            throw "Sample rate 0 or less";
+
+        const std::string& text = suffixArray.GetText();
+        const std::vector<int>& sa = suffixArray.GetSa();
+        FMIndexFileHeader fileHeader;
+        uint64_t n = text.length();
+
+        fileHeader.textLength = n;
+        fileHeader.rows = n + 1;
+        fileHeader.sampleRate = sampleRate;
+        fileHeader.sampleCount = n / sampleRate + 1;
+
+        // Row 0 is the sentinel suffix, and row r the suffix sa[r - 1]; the sentinel itself is stored as 0
+        std::vector<unsigned char> bwt(n + 1);
+        bwt[0] = text[n - 1];
+
+        for (uint64_t r = 1; r <= n; r++)
+        {
+            int position = sa[r - 1];
+
+            if (position == 0)
+                fileHeader.sentinelRow = r;
+
+            bwt[r] = position == 0 ? 0 : text[position - 1];
+        }
+
+        // counts[c] starts past the sentinel row and every smaller byte
+        for (uint64_t i = 0; i < n; i++)
+            fileHeader.counts[(unsigned char) text[i] + 1]++;
+
+        fileHeader.counts[0] = 1;
+
+        for (int c = 1; c <= 256; c++)
+            fileHeader.counts[c] += fileHeader.counts[c - 1];
+
+        storage.assign(fileHeader.FileSize() / sizeof(uint64_t), 0);
+        memcpy(storage.data(), &fileHeader, sizeof(FMIndexFileHeader));
+
+        char* base = (char*) storage.data();
+        FMIndexFileHeader* outHeader = (FMIndexFileHeader*) base;
+        uint64_t words = FMIndexFileHeader::BitvectorWords(n + 1);
+        uint64_t* outLevels = (uint64_t*) (base + fileHeader.LevelsPosition());
+        uint64_t* outSampled = (uint64_t*) (base + fileHeader.SampledPosition());
+        uint32_t* outSamples = (uint32_t*) (base + fileHeader.SamplesPosition());
+
+        // Every level stores one bit of every byte, then stably moves the 0 bits in front of the 1 bits
+        std::vector<unsigned char> next(n + 1);
+
+        for (int level = 0; level < 8; level++)
+        {
+            uint64_t* bitvector = outLevels + level * words;
+            uint64_t zeros = 0;
+
+            for (uint64_t r = 0; r <= n; r++)
+            {
+                if ((bwt[r] >> (7 - level)) & 1)
+                    SetBit(bitvector, r);
+                else
+                    zeros++;
+            }
+
+            BuildRanks(bitvector, n + 1);
+            outHeader->zeros[level] = zeros;
+
+            uint64_t zero = 0, one = zeros;
+
+            for (uint64_t r = 0; r <= n; r++)
+                next[(bwt[r] >> (7 - level)) & 1 ? one++ : zero++] = bwt[r];
+
+            bwt.swap(next);
+        }
+
+        // Sample every suffix position divisible by the sample rate, in row order
+        for (uint64_t r = 0, sample = 0; r <= n; r++)
+        {
+            uint64_t position = r == 0 ? n : sa[r - 1];
+
+            if (position % sampleRate == 0)
+            {
+                SetBit(outSampled, r);
+                outSamples[sample++] = (uint32_t) position;
+            }
+        }
+
+        BuildRanks(outSampled, n + 1);
+        Attach(base);
+    }
+
+    /**
+     * @brief FMIndex constructor from a saved index file, which is memory mapped and queried in place
+     * @param path Path of the index file
+     */
+    FMIndex(const std::string& path)
+    {
+        fd = open(path.c_str(), O_RDONLY);
+
+        if (fd == -1)
+            throw "Unable to open index file";
+
+        struct stat info;
+
+        if (fstat(fd, &info) == -1 || (size_t) info.st_size < sizeof(FMIndexFileHeader))
+        {
+            Close();
+            throw "Invalid index file";
+        }
+
+        mappingSize = (size_t) info.st_size;
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+            Close();
+            throw "Unable to map index file";
+        }
+
+        // Validate the header before trusting any of the section positions
+        const FMIndexFileHeader* fileHeader = (const FMIndexFileHeader*) mapping;
+
+        if (fileHeader->magic != FMIndexFileHeader::MAGIC || fileHeader->version != FMIndexFileHeader::VERSION ||
+            fileHeader->rows != fileHeader->textLength + 1 || fileHeader->sampleRate == 0 ||
+            fileHeader->rows > mappingSize || fileHeader->sampleCount > mappingSize ||
+            fileHeader->FileSize() != mappingSize)
+        {
+            Close();
+            throw "Invalid index file";
+        }
+
+        Attach(mapping);
+
+        if (!IsValid())
+        {
+            Close();
+            throw "Invalid index file";
+        }
+    }
+
+    ~FMIndex()
+    {
+        Close();
+    }
+
+    FMIndex(const FMIndex&) = delete;
+    FMIndex& operator=(const FMIndex&) = delete;
+
+    /**
+     * @brief The Save() function writes the index buffer to a file.
+     * @param path Path of the index file to be written
+     */
+    void Save(const std::string& path) const
+    {
+        FILE* file = fopen(path.c_str(), "wb");
+
+        if (file == nullptr)
+            throw "Unable to create index file";
+
+        size_t size = (size_t) header->FileSize();
+        size_t written = fwrite(header, 1, size, file);
+
+        if (fclose(file) != 0 || written != size)
+            throw "Unable to write index file";
+    }
+
+    /**
+     * @brief The Count() function counts the occurrences of a pattern with backward search.
+     * @param pattern The pattern to search for
+     * @return Returns the number of occurrences
+     */
+    uint64_t Count(std::string_view pattern) const
+    {
+        uint64_t first, last;
+
+        return Search(pattern, first, last) ? last - first : 0;
+    }
+
+    /**
+     * @brief The Search() function finds the range of rows whose suffixes start with a pattern.
+     * @param pattern The pattern to search for
+     * @param first Receives the first row of the range
+     * @param last Receives one past the last row of the range
+     * @return Returns false if the pattern does not occur
+     */
+    bool Search(std::string_view pattern, uint64_t& first, uint64_t& last) const
+    {
+        // Row 0 is the empty sentinel suffix, which only the empty pattern skips
+        first = pattern.empty() ? 1 : 0;
+        last = header->rows;
+
+        for (size_t i = pattern.size(); i-- > 0 && first < last; )
+        {
+            int c = (unsigned char) pattern[i];
+
+            first = header->counts[c] + Rank(c, first);
+            last = header->counts[c] + Rank(c, last);
+        }
+
+        return first < last;
+    }
+
+    /**
+     * @brief The Locate() function finds every occurrence of a pattern.
+     * @param pattern The pattern to search for
+     * @return Returns the start positions of the occurrences, in suffix order
+     */
+    std::vector<int> Locate(std::string_view pattern) const
+    {
+        std::vector<int> positions;
+        uint64_t first, last;
+
+        if (!Search(pattern, first, last))
+            return positions;
+
+        positions.reserve(last - first);
+
+        for (uint64_t row = first; row < last; row++)
+        {
+            uint64_t r = row;
+            uint64_t steps = 0;
+
+            // Step back through the text until a sampled position; position 0 is always sampled
+            while (!Bit(sampled, r))
+            {
+                int c = Access(r);
+                r = header->counts[c] + Rank(c, r);
+                steps++;
+            }
+
+            positions.emplace_back((int) (samples[Rank1(sampled, r)] + steps));
+        }
+
+        return positions;
+    }
+
+    /**
+     * @brief The TextLength() function returns the length of the indexed text.
+     * @return Returns the number of characters in the text
+     */
+    uint64_t TextLength() const
+    {
+        return header->textLength;
+    }
+
+    /**
+     * @brief The MemoryUsage() function returns the size of the index buffer.
+     * @return Returns the size of the index in bytes
+     */
+    size_t MemoryUsage() const
+    {
+        return (size_t) header->FileSize();
+    }
+
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @file FMIndexFile.h
+ * @author 0xChristopher
+ * @brief The FMIndexFileHeader struct describes the layout of an FM-index, both in memory and on disk. The
+ *      index is a single buffer of 8 byte words, so the buffer built in memory is written to a file as is,
+ *      and a file is queried by memory mapping it without any parsing.
+ *
+ *      Every bitvector is stored in blocks of 9 words: the number of set bits before the block, followed by
+ *      512 bits of data. A rank query therefore touches a single cache line or two.
+ *
+ *      File Layout:
+ *              Header          sizeof(FMIndexFileHeader) bytes
+ *              Levels          8 bitvectors of 'rows' bits     levels of the wavelet matrix over the BWT
+ *              Sampled         bitvector of 'rows' bits        marks the rows whose suffix position is sampled
+ *              Samples         uint32_t[sampleCount]           suffix positions of the marked rows, in row order
+ */
+
+struct FMIndexFileHeader
+{
+
+    static constexpr uint64_t MAGIC = 0x315845444E494D46ULL;    // "FMINDEX1" tag used to validate a file
+    static constexpr uint64_t VERSION = 1;                      // Current FM-index file format version
+
+    uint64_t magic = MAGIC;             // Must equal MAGIC
+    uint64_t version = VERSION;         // Must equal VERSION
+    uint64_t textLength = 0;            // Length of the indexed text
+    uint64_t rows = 0;                  // Length of the BWT, which is textLength + 1 for the sentinel
+    uint64_t sentinelRow = 0;           // Row of the BWT that holds the sentinel
+    uint64_t sampleRate = 0;            // Every suffix position divisible by sampleRate is sampled
+    uint64_t sampleCount = 0;           // Number of sampled suffix positions
+    uint64_t zeros[8] = {};             // Number of 0 bits on every level of the wavelet matrix
+    uint64_t counts[257] = {};          // counts[c] is the first row of the suffixes starting with byte c
+
+    /**
+     * @brief The BitvectorWords() function returns the size of a bitvector with its rank blocks.
+     * @param bits The number of bits in the bitvector
+     * @return Returns the number of 8 byte words
+     */
+    static uint64_t BitvectorWords(uint64_t bits)
+    {
+        return (bits / 512 + 1) * 9;
+    }
+
+    /**
+     * @brief The LevelsPosition() function returns the byte position of the wavelet matrix levels.
+     * @return Returns the position of the first level within the file
+     */
+    uint64_t LevelsPosition() const
+    {
+        return sizeof(FMIndexFileHeader);
+    }
+
+    /**
+     * @brief The SampledPosition() function returns the byte position of the sampled rows bitvector.
+     * @return Returns the position of the bitvector within the file
+     */
+    uint64_t SampledPosition() const
+    {
+        return LevelsPosition() + 8 * BitvectorWords(rows) * sizeof(uint64_t);
+    }
+
+    /**
+     * @brief The SamplesPosition() function returns the byte position of the sampled suffix positions.
+     * @return Returns the position of the samples within the file
+     */
+    uint64_t SamplesPosition() const
+    {
+        return SampledPosition() + BitvectorWords(rows) * sizeof(uint64_t);
+    }
+
+    /**
+     * @brief The FileSize() function returns the total size of an FM-index with this header, padded to a
+     *      whole number of words.
+     * @return Returns the size of the file in bytes
+     */
+    uint64_t FileSize() const
+    {
+        return (SamplesPosition() + sampleCount * sizeof(uint32_t) + 7) / 8 * 8;
+    }
+
+};
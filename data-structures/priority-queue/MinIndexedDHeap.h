@@ -227,12 +227,12 @@ class MinIndexedDHeap
         this->d = fmax(2, degree);
         this->n = fmax(d + 1, maxSize);
 
-        // Resize vectors for efficiency
-        this->pm.resize(maxSize);
-        this->im.resize(maxSize);
-        this->values.resize(maxSize);
-        this->parents.resize(maxSize);
-        this->children.resize(maxSize);
+        // Resize vectors for efficiency; 'n' may exceed maxSize for small heaps of a high degree
+        this->pm.resize(n);
+        this->im.resize(n);
+        this->values.resize(n);
+        this->parents.resize(n);
+        this->children.resize(n);
 
         // Initialize vectors
         for (int i = 0; i < n; i++)
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+/**
+ * @file CompactLcpArray.h
+ * @author 0xChristopher
+ * @brief The CompactLcpArray struct stores an LCP Array in about one byte per entry. Most LCP values of
+ *      real text are small, so every value below 255 is stored as a single byte, and 255 marks a value
+ *      that lives in a separate overflow table of (index, value) pairs sorted by index. Reading an
+ *      overflowing entry is a binary search of that table.
+ *
+ *      Space Complexity: n + 8 * (number of values of 255 or more) bytes
+ */
+
+struct CompactLcpArray
+{
+
+    static const int OVERFLOW_MARK = 255;               // Byte value of an entry in the overflow table
+
+    std::vector<uint8_t> values;                        // LCP values below 255, or OVERFLOW_MARK
+    std::vector<std::pair<int, int>> overflow;          // (index, value) of every large entry, sorted by index
+
+    /**
+     * @param i Index of the entry
+     * @return Returns the LCP value at index i
+     */
+    int operator[](int i) const
+    {
+        if (values[i] != OVERFLOW_MARK)
+            return values[i];
+
+        auto it = std::lower_bound(overflow.begin(), overflow.end(), std::make_pair(i, 0));
+
+        return it->second;
+    }
+
+    /**
+     * @return Returns the number of entries
+     */
+    int size() const
+    {
+        return (int) values.size();
+    }
+
+    /**
+     * @return Returns the bytes used by the entries and the overflow table
+     */
+    size_t MemoryUsage() const
+    {
+        return values.capacity() + overflow.capacity() * sizeof(std::pair<int, int>);
+    }
+
+};
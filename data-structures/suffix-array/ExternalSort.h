@@ -0,0 +1,346 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <memory>
+
+/**
+ * @file ExternalSort.h
+ * @author 0xChristopher
+ * @brief Building blocks for algorithms whose data does not fit in memory. RecordWriter and RecordReader
+ *      stream fixed size records to and from a binary file through a buffer. A writer must be closed with
+ *      Close() before its file is used, since that is where a failed write is reported. ExternalSorter
+ *      sorts any number of records within a memory budget: records pushed into it are collected in a
+ *      buffer, and every time the buffer fills up it is sorted and written to a temporary run file.
+ *      Finish() then merges the runs with a heap and hands the records to a sink in sorted order. When
+ *      there are more runs than read buffers fit in the budget, groups of runs are first merged into
+ *      longer runs.
+ *
+ *      Time Complexity: O(n*log(n)) comparisons, and every record is written and read once per merge pass
+ */
+
+template <typename Record>
+
+class RecordWriter
+{
+
+    private:
+    FILE* file = nullptr;                       // Output file
+    std::vector<Record> buffer;                 // Records waiting to be written
+
+    public:
+    /**
+     * @brief RecordWriter constructor and destructor
+     * @param path Path of the file to be written
+     * @param bufferRecords Number of records written at once
+     */
+    RecordWriter(const std::string& path, size_t bufferRecords = 1 << 16)
+    {
+        file = fopen(path.c_str(), "wb");
+
+        if (file == nullptr)
+            throw "Unable to create file";
+
+        buffer.reserve(std::max<size_t>(1, bufferRecords));
+    }
+
+    ~RecordWriter()
+    {
+        // A writer that was never closed is abandoned; there is no way to report an error from here
+        if (file != nullptr)
+            fclose(file);
+    }
+
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    /**
+     * @brief The Write() function appends a record to the file.
+     * @param record The record to be written
+     */
+    void Write(const Record& record)
+    {
+        buffer.push_back(record);
+
+        if (buffer.size() == buffer.capacity())
+            Flush();
+    }
+
+    /**
+     * @brief The Flush() function writes every buffered record to the file.
+     */
+    void Flush()
+    {
+        if (!buffer.empty() && fwrite(buffer.data(), sizeof(Record), buffer.size(), file) != buffer.size())
+            throw "Unable to write file";
+
+        buffer.clear();
+    }
+
+    /**
+     * @brief The Close() function writes every buffered record and closes the file. A write that failed
+     *      in any buffer, including the buffer of the C library, is only reported here.
+     */
+    void Close()
+    {
+        Flush();
+
+        FILE* closing = file;
+        file = nullptr;
+
+        if (fclose(closing) != 0)
+            throw "Unable to write file";
+    }
+
+};
+
+template <typename Record>
+
+class RecordReader
+{
+
+    private:
+    FILE* file = nullptr;                       // Input file
+    std::vector<Record> buffer;                 // Records read ahead
+    size_t next = 0;                            // Position of the next record in the buffer
+    size_t bufferRecords;                       // Number of records read at once
+
+    /**
+     * @brief The Fill() function reads the next block of records into the buffer.
+     */
+    void Fill()
+    {
+        buffer.resize(bufferRecords);
+        buffer.resize(fread(buffer.data(), sizeof(Record), bufferRecords, file));
+        next = 0;
+
+        if (buffer.empty() && ferror(file))
+            throw "Unable to read file";
+    }
+
+    public:
+    /**
+     * @brief RecordReader constructor and destructor
+     * @param path Path of the file to be read
+     * @param skip Number of records to skip at the start of the file
+     * @param bufferRecords Number of records read at once
+     */
+    RecordReader(const std::string& path, size_t skip = 0, size_t bufferRecords = 1 << 16)
+        : bufferRecords(std::max<size_t>(1, bufferRecords))
+    {
+        file = fopen(path.c_str(), "rb");
+
+        if (file == nullptr)
+            throw "Unable to open file";
+
+        if (skip > 0 && fseek(file, (long) (skip * sizeof(Record)), SEEK_SET) != 0)
+        {
+            fclose(file);
+            throw "Unable to seek file";
+        }
+    }
+
+    ~RecordReader()
+    {
+        fclose(file);
+    }
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    /**
+     * @brief The Read() function reads the next record from the file.
+     * @param record Receives the record
+     * @return Returns false once the end of the file has been reached
+     */
+    bool Read(Record& record)
+    {
+        if (next == buffer.size())
+        {
+            Fill();
+
+            if (buffer.empty())
+                return false;
+        }
+
+        record = buffer[next++];
+
+        return true;
+    }
+
+};
+
+template <typename Record, typename Less>
+
+class ExternalSorter
+{
+
+    private:
+    static const size_t minReadBuffer = 1 << 16;    // Smallest read buffer of a run during a merge, in bytes
+
+    Less less;                                  // Strict weak order of the records
+    std::string tempPrefix;                     // Prefix of the temporary run files
+    size_t memoryBudget;                        // Bytes available for buffered records
+    std::vector<Record> buffer;                 // Records not yet written to a run
+    std::vector<std::string> runs;              // Paths of the sorted runs on disk
+    int runsCreated = 0;                        // Number of run files created, used to name them
+
+    /**
+     * @brief The NewRunPath() function names the next temporary run file.
+     * @return Returns the path of the run file
+     */
+    std::string NewRunPath()
+    {
+        return tempPrefix + ".run" + std::to_string(runsCreated++);
+    }
+
+    /**
+     * @brief The SpillRun() function sorts the buffered records and writes them to a new run.
+     */
+    void SpillRun()
+    {
+        std::sort(buffer.begin(), buffer.end(), less);
+
+        std::string path = NewRunPath();
+        RecordWriter<Record> writer(path);
+
+        for (const Record& record : buffer)
+            writer.Write(record);
+
+        writer.Close();
+        runs.emplace_back(path);
+        buffer.clear();
+    }
+
+    /**
+     * @brief The Merge() function merges sorted runs into a sink and deletes them.
+     * @param first The first run to be merged
+     * @param last One past the last run to be merged
+     * @param sink Receives the merged records in order
+     */
+    template <typename Sink>
+    void Merge(size_t first, size_t last, Sink& sink)
+    {
+        size_t count = last - first;
+        size_t bufferRecords = std::max<size_t>(1, memoryBudget / (count + 1) / sizeof(Record));
+        std::vector<std::unique_ptr<RecordReader<Record>>> readers;
+        std::vector<Record> heads(count);
+
+        // The heap holds the index of every run that still has records, ordered by its head record
+        auto later = [this, &heads](size_t a, size_t b) { return less(heads[b], heads[a]); };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heap(later);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            readers.emplace_back(new RecordReader<Record>(runs[first + i], 0, bufferRecords));
+
+            if (readers[i]->Read(heads[i]))
+                heap.push(i);
+        }
+
+        while (!heap.empty())
+        {
+            size_t i = heap.top();
+            heap.pop();
+            sink(heads[i]);
+
+            if (readers[i]->Read(heads[i]))
+                heap.push(i);
+        }
+
+        readers.clear();
+
+        for (size_t i = 0; i < count; i++)
+            remove(runs[first + i].c_str());
+    }
+
+    public:
+    /**
+     * @brief ExternalSorter constructor and destructor
+     * @param memoryBudget Bytes available for buffered records
+     * @param tempPrefix Prefix of the temporary run files, for example "/tmp/sort"
+     * @param less Strict weak order of the records
+     */
+    ExternalSorter(size_t memoryBudget, const std::string& tempPrefix, Less less = Less())
+        : less(less), tempPrefix(tempPrefix), memoryBudget(std::max(memoryBudget, 2 * minReadBuffer))
+    {
+        buffer.reserve(std::max<size_t>(1, this->memoryBudget / sizeof(Record)));
+    }
+
+    ~ExternalSorter()
+    {
+        for (const std::string& path : runs)
+            remove(path.c_str());
+    }
+
+    ExternalSorter(const ExternalSorter&) = delete;
+    ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+    /**
+     * @brief The Push() function adds a record to be sorted.
+     * @param record The record to be added
+     */
+    void Push(const Record& record)
+    {
+        buffer.push_back(record);
+
+        if (buffer.size() == buffer.capacity())
+            SpillRun();
+    }
+
+    /**
+     * @brief The Finish() function hands every pushed record to a sink in sorted order, after which the
+     *      sorter is empty again.
+     * @param sink Called with every record in order
+     */
+    template <typename Sink>
+    void Finish(Sink sink)
+    {
+        // Everything fit in memory, so no run was ever written
+        if (runs.empty())
+        {
+            std::sort(buffer.begin(), buffer.end(), less);
+
+            for (const Record& record : buffer)
+                sink(record);
+
+            buffer.clear();
+            return;
+        }
+
+        if (!buffer.empty())
+            SpillRun();
+
+        // Merge groups of runs until a single merge can read all of them within the budget
+        size_t fanIn = std::max<size_t>(2, memoryBudget / minReadBuffer - 1);
+
+        while (runs.size() > fanIn)
+        {
+            std::vector<std::string> merged;
+
+            for (size_t first = 0; first < runs.size(); first += fanIn)
+            {
+                size_t last = std::min(runs.size(), first + fanIn);
+                std::string path = NewRunPath();
+
+                {
+                    RecordWriter<Record> writer(path);
+                    auto write = [&writer](const Record& record) { writer.Write(record); };
+                    Merge(first, last, write);
+                    writer.Close();
+                }
+
+                merged.emplace_back(path);
+            }
+
+            runs.swap(merged);
+        }
+
+        Merge(0, runs.size(), sink);
+        runs.clear();
+    }
+
+};
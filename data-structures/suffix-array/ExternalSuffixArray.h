@@ -0,0 +1,331 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ExternalSort.h"
+
+/**
+ * @file ExternalSuffixArray.h
+ * @author 0xChristopher
+ * @brief The ExternalSuffixArray class builds the Suffix Array (SA) and LCP Array of a text file that may
+ *      be larger than memory. Nothing proportional to the text is ever held in memory; the data streams
+ *      through temporary files and ExternalSorter (see ExternalSort.h) under a memory budget.
+ *
+ *      The SA is built by prefix doubling. The ranks of the first k characters of every suffix are kept in
+ *      a file in text order, so the rank of suffix i + k is read by a second sequential reader that runs k
+ *      records ahead of the first. Every round sorts the (rank[i], rank[i + k], i) triples externally,
+ *      renames the pairs in a single scan, and sorts the new ranks back into text order. The order of the
+ *      triples is written out as the SA each round, and the build stops once every rank is distinct.
+ *
+ *      The LCP Array is built with the Phi algorithm: sorting (sa[j], sa[j - 1], j) by text position gives
+ *      every suffix the one before it in the SA, so the permuted LCP can be computed in text order, where
+ *      each value is at least the previous one minus 1. The text is memory mapped for these comparisons.
+ *      The permuted values are then sorted back into SA order.
+ *
+ *      Both arrays are written as raw int32 files, which MappedSuffixArray (see MappedSuffixArray.h) maps
+ *      and queries in place, and which SuffixArray::Save() also produces.
+ *
+ *      NOTE: The memory budget is split between the two sorters that run at the same time. This class
+ *      relies on the POSIX mmap() interface.
+ *
+ *      Time Complexity: O(n*log(n)*log(h)) where h is the longest repeated substring of the text
+ */
+
+class ExternalSuffixArray
+{
+
+    private:
+    struct PairRecord
+    {
+        int32_t first;                          // Rank of the first k characters
+        int32_t second;                         // Rank of the next k characters, or 0 past the end
+        int32_t position;                       // Start of the suffix
+    };
+
+    struct RankRecord
+    {
+        int32_t position;                       // Start of the suffix
+        int32_t rank;                           // New rank of the suffix
+    };
+
+    struct PhiRecord
+    {
+        int32_t position;                       // Start of the suffix
+        int32_t previous;                       // Start of the suffix before it in the SA, or -1
+        int32_t rank;                           // Rank of the suffix in the SA
+    };
+
+    struct LcpRecord
+    {
+        int32_t rank;                           // Rank of the suffix in the SA
+        int32_t lcp;                            // LCP of the suffix with the one before it in the SA
+    };
+
+    struct PairLess
+    {
+        bool operator()(const PairRecord& a, const PairRecord& b) const
+        {
+            return a.first < b.first || (a.first == b.first && a.second < b.second);
+        }
+    };
+
+    struct PositionLess
+    {
+        template <typename Record>
+        bool operator()(const Record& a, const Record& b) const
+        {
+            return a.position < b.position;
+        }
+    };
+
+    struct RankLess
+    {
+        template <typename Record>
+        bool operator()(const Record& a, const Record& b) const
+        {
+            return a.rank < b.rank;
+        }
+    };
+
+    std::string m_textPath;                     // Path of the text file
+    size_t m_memoryBudget;                      // Bytes available to the external sorts
+    std::string m_tempPrefix;                   // Prefix of every temporary file
+    int64_t length = 0;                         // Length of the text
+    int rounds = 0;                             // Doubling rounds used by the last build
+
+    /**
+     * @brief The WriteInitialRanks() function ranks every suffix by its first character.
+     * @param rankPath Path of the rank file to be written
+     */
+    void WriteInitialRanks(const std::string& rankPath)
+    {
+        FILE* text = fopen(m_textPath.c_str(), "rb");
+
+        if (text == nullptr)
+            throw "Unable to open text file";
+
+        try
+        {
+            RecordWriter<int32_t> ranks(rankPath);
+            int ch;
+
+            while ((ch = fgetc(text)) != EOF)
+                ranks.Write(ch + 1);
+
+            if (ferror(text))
+                throw "Unable to read text file";
+
+            ranks.Close();
+        }
+        catch (...)
+        {
+            fclose(text);
+            throw;
+        }
+
+        fclose(text);
+    }
+
+    /**
+     * @brief The DoublingRound() function sorts the suffixes by their first 2k characters.
+     * @param rankPath Path of the rank file, which is replaced by the new ranks
+     * @param saPath Path of the SA file, which receives the new order of the suffixes
+     * @param k The number of characters the current ranks cover
+     * @return Returns true once every rank is distinct
+     */
+    bool DoublingRound(const std::string& rankPath, const std::string& saPath, int64_t k)
+    {
+        int64_t n = length;
+        size_t budget = m_memoryBudget / 2;
+        ExternalSorter<PairRecord, PairLess> pairs(budget, m_tempPrefix + ".pairs");
+        ExternalSorter<RankRecord, PositionLess> ranks(budget, m_tempPrefix + ".ranks");
+
+        // Read rank[i] and rank[i + k] side by side
+        {
+            RecordReader<int32_t> first(rankPath);
+            RecordReader<int32_t> second(rankPath, k < n ? (size_t) k : 0);
+            int32_t rank1 = 0, rank2 = 0;
+
+            for (int64_t i = 0; i < n; i++)
+            {
+                first.Read(rank1);
+                rank2 = 0;
+
+                if (i + k < n)
+                    second.Read(rank2);
+
+                pairs.Push({ rank1, rank2, (int32_t) i });
+            }
+        }
+
+        // Every suffix is ranked one past the number of suffixes with a smaller pair
+        int64_t sorted = 0, groupStart = 0, distinct = 0;
+        PairRecord previous = { -1, -1, -1 };
+
+        {
+            RecordWriter<int32_t> sa(saPath);
+
+            pairs.Finish([&](const PairRecord& record)
+            {
+                if (record.first != previous.first || record.second != previous.second)
+                {
+                    groupStart = sorted;
+                    distinct++;
+                }
+
+                sa.Write(record.position);
+                ranks.Push({ record.position, (int32_t) (groupStart + 1) });
+                previous = record;
+                sorted++;
+            });
+
+            sa.Close();
+        }
+
+        if (distinct == n)
+            return true;
+
+        RecordWriter<int32_t> newRanks(rankPath);
+        ranks.Finish([&newRanks](const RankRecord& record) { newRanks.Write(record.rank); });
+        newRanks.Close();
+
+        return false;
+    }
+
+    /**
+     * @brief The BuildLcp() function builds the LCP Array from the SA with the Phi algorithm.
+     * @param saPath Path of the SA file
+     * @param lcpPath Path of the LCP file to be written
+     */
+    void BuildLcp(const std::string& saPath, const std::string& lcpPath)
+    {
+        int64_t n = length;
+        size_t budget = m_memoryBudget / 2;
+        ExternalSorter<PhiRecord, PositionLess> phi(budget, m_tempPrefix + ".phi");
+        ExternalSorter<LcpRecord, RankLess> plcp(budget, m_tempPrefix + ".plcp");
+
+        {
+            RecordReader<int32_t> sa(saPath);
+            int32_t position = 0, previous = -1;
+
+            for (int64_t j = 0; j < n; j++)
+            {
+                sa.Read(position);
+                phi.Push({ position, previous, (int32_t) j });
+                previous = position;
+            }
+        }
+
+        // Map the text for the character comparisons
+        int fd = open(m_textPath.c_str(), O_RDONLY);
+
+        if (fd == -1)
+            throw "Unable to open text file";
+
+        void* mapping = mmap(nullptr, (size_t) n, PROT_READ, MAP_SHARED, fd, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            close(fd);
+            throw "Unable to map text file";
+        }
+
+        const unsigned char* text = (const unsigned char*) mapping;
+        int64_t match = 0;
+
+        phi.Finish([&](const PhiRecord& record)
+        {
+            if (record.previous == -1)
+            {
+                match = 0;
+            }
+            else
+            {
+                while (record.position + match < n && record.previous + match < n &&
+                    text[record.position + match] == text[record.previous + match])
+                    match++;
+            }
+
+            plcp.Push({ record.rank, (int32_t) match });
+
+            if (match > 0)
+                match--;
+        });
+
+        munmap(mapping, (size_t) n);
+        close(fd);
+
+        RecordWriter<int32_t> lcp(lcpPath);
+        plcp.Finish([&lcp](const LcpRecord& record) { lcp.Write(record.lcp); });
+        lcp.Close();
+    }
+
+    public:
+    /**
+     * @brief ExternalSuffixArray constructor and destructor
+     * @param textPath Path of the text file
+     * @param memoryBudget Bytes available to the external sorts
+     * @param tempPrefix Prefix of every temporary file, for example "/tmp/esa"
+     */
+    ExternalSuffixArray(const std::string& textPath, size_t memoryBudget, const std::string& tempPrefix)
+        : m_textPath(textPath), m_memoryBudget(memoryBudget), m_tempPrefix(tempPrefix)
+    {
+
+    }
+
+    ~ExternalSuffixArray()
+    {
+
+    }
+
+    /**
+     * @brief The Build() function builds the SA and LCP Array and writes them as raw int32 files.
+     * @param saPath Path of the SA file to be written
+     * @param lcpPath Path of the LCP file to be written
+     */
+    void Build(const std::string& saPath, const std::string& lcpPath)
+    {
+        struct stat info;
+
+        if (stat(m_textPath.c_str(), &info) == -1)
+            throw "Unable to open text file";
+
+        if (info.st_size == 0)
+            throw "Text cannot be null";
+        else if (info.st_size >= INT32_MAX)
+            throw "Text too long";
+
+        length = info.st_size;
+        rounds = 0;
+
+        std::string rankPath = m_tempPrefix + ".rank";
+        WriteInitialRanks(rankPath);
+
+        for (int64_t k = 1; ; k *= 2)
+        {
+            rounds++;
+
+            if (DoublingRound(rankPath, saPath, k))
+                break;
+        }
+
+        remove(rankPath.c_str());
+        BuildLcp(saPath, lcpPath);
+    }
+
+    /**
+     * @brief The GetRounds() function returns the number of doubling rounds of the last build.
+     * @return Returns the number of rounds
+     */
+    int GetRounds()
+    {
+        return rounds;
+    }
+
+};
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+
+#include "ExternalSuffixArray.h"
+#include "MappedSuffixArray.h"
+
+/**
+ * @file ExternalSuffixArrayExample.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the external memory Suffix Array builder, checked against the in-memory
+ *      SuffixArray, and of querying the result through a memory mapping
+ */
+
+int main()
+{
+    std::string textPath = "corpus.txt";        // Text to be indexed
+    std::string saPath = "corpus.sa";           // SA written by the external builder
+    std::string lcpPath = "corpus.lcp";         // LCP Array written by the external builder
+    int textLength = 2000000;                   // Length of the generated text
+    size_t memoryBudget = 4 << 20;              // Memory available to the external sorts
+
+    // Write a text with long repeats, which needs more doubling rounds than random letters
+    std::mt19937 rng(42);
+    std::string text;
+
+    while ((int) text.length() < textLength)
+    {
+        if (text.length() > 1000 && rng() % 4 == 0)
+            text += text.substr(rng() % (text.length() - 1000), 200 + rng() % 800);
+        else
+            text += (char) ('a' + rng() % 4);
+    }
+
+    text.resize(textLength);
+    std::ofstream(textPath, std::ios::binary) << text;
+
+    // Build the arrays under a small memory budget
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Building the SA and LCP Array of " << textLength << " characters with a " << 
+        (memoryBudget >> 20) << " MB budget..." << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    ExternalSuffixArray builder(textPath, memoryBudget, "corpus.tmp");
+    builder.Build(saPath, lcpPath);
+    auto end = std::chrono::steady_clock::now();
+
+    printf("External build: %.1f ms in %d doubling rounds\n", 
+        std::chrono::duration<double, std::milli>(end - start).count(), builder.GetRounds());
+
+    // Compare with the in-memory build
+    SuffixArray suffixArray(text);
+    MappedSuffixArray mapped(textPath, saPath, lcpPath);
+    const std::vector<int>& sa = suffixArray.GetSa();
+    const std::vector<int>& lcp = suffixArray.GetLcpArray();
+    bool same = true;
+
+    for (int i = 0; i < textLength; i++)
+        same = same && sa[i] == mapped.Sa(i) && lcp[i] == mapped.Lcp(i);
+
+    std::cout << "Matches the in-memory SuffixArray: " << (same ? "yes" : "no") << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Query the mapped files
+    std::string pattern = text.substr(textLength / 2, 12);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Count(\"" << pattern << "\"): " << mapped.Count(pattern) << std::endl;
+    std::cout << "First occurrences: { ";
+
+    SuffixRange occurrences = mapped.Locate(pattern);
+
+    for (int i = 0; i < std::min(10, occurrences.size()); i++)
+        std::cout << occurrences[i] << " ";
+
+    std::cout << "}" << std::endl;
+    std::cout << "Longest repeated substring length: " << mapped.LongestRepeatedSubstring().length() << std::endl;
+    std::cout << "Distinct substrings: " << mapped.DistinctSubstringCount() << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    remove(textPath.c_str());
+    remove(saPath.c_str());
+    remove(lcpPath.c_str());
+
+    return 0;
+}
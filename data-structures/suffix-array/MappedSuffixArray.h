@@ -0,0 +1,300 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "SuffixArray.h"
+
+/**
+ * @file MappedSuffixArray.h
+ * @author 0xChristopher
+ * @brief The MappedSuffixArray class answers the queries of SuffixArray straight out of files, by memory
+ *      mapping a text file together with its SA and LCP Array stored as raw int32 files, as written by
+ *      ExternalSuffixArray::Build() or SuffixArray::Save(). Opening maps the files and checks every SA and
+ *      LCP entry in one sequential pass, so that no query on corrupt files reads outside the text. Texts
+ *      larger than memory can be queried, and the page cache decides what stays resident.
+ *
+ *      Count() and Locate() binary search the mapped SA. The search keeps the LCP of the pattern with
+ *      both ends of the current range and skips the shorter of the two when comparing the midpoint, which
+ *      needs no extra arrays. Locate() returns a SuffixRange that points into the mapped SA.
+ *
+ *      NOTE: This class relies on the POSIX mmap() interface.
+ *
+ *      Time Complexity:
+ *              Open                    O(n)
+ *              Count/Locate            O(m*logn)       per pattern of length m, usually close to O(m + logn)
+ */
+
+class MappedSuffixArray
+{
+
+    private:
+    struct Mapping
+    {
+        int fd = -1;                            // File descriptor of the mapped file
+        void* data = nullptr;                   // Start of the memory mapping
+        size_t size = 0;                        // Size of the mapped file in bytes
+    };
+
+    Mapping textFile;                           // Mapped text
+    Mapping saFile;                             // Mapped SA
+    Mapping lcpFile;                            // Mapped LCP Array
+    const char* text = nullptr;                 // Text
+    const int32_t* sa = nullptr;                // Sorted suffix array values
+    const int32_t* lcp = nullptr;               // Longest common prefix array
+    int size = 0;                               // Length of the text
+
+    /**
+     * @brief The Open() function maps a file read only.
+     * @param path Path of the file
+     * @param file Receives the mapping
+     */
+    static void Open(const std::string& path, Mapping& file)
+    {
+        file.fd = open(path.c_str(), O_RDONLY);
+
+        if (file.fd == -1)
+            throw "Unable to open file";
+
+        struct stat info;
+
+        if (fstat(file.fd, &info) == -1 || info.st_size == 0)
+            throw "Invalid file";
+
+        file.size = (size_t) info.st_size;
+        file.data = mmap(nullptr, file.size, PROT_READ, MAP_SHARED, file.fd, 0);
+
+        if (file.data == MAP_FAILED)
+        {
+            file.data = nullptr;
+            throw "Unable to map file";
+        }
+    }
+
+    /**
+     * @brief The Close() function unmaps a file and closes its file descriptor.
+     * @param file The mapping to be closed
+     */
+    static void Close(Mapping& file)
+    {
+        if (file.data != nullptr)
+            munmap(file.data, file.size);
+
+        if (file.fd != -1)
+            close(file.fd);
+
+        file = Mapping();
+    }
+
+    /**
+     * @brief The CloseAll() function closes every mapped file.
+     */
+    void CloseAll()
+    {
+        Close(textFile);
+        Close(saFile);
+        Close(lcpFile);
+    }
+
+    /**
+     * @brief The IsValid() function checks that every SA entry is a position of the text, and that no
+     *      LCP entry runs past the end of its suffix.
+     * @return Returns true if the arrays are consistent
+     */
+    bool IsValid() const
+    {
+        for (int i = 0; i < size; i++)
+        {
+            if (sa[i] < 0 || sa[i] >= size || lcp[i] < 0 || lcp[i] > size - sa[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief The Bound() function binary searches the SA for the first suffix that is not smaller than
+     *      the pattern, or with 'upper' set, the first suffix that is greater than it.
+     * @param pattern The pattern to search for
+     * @param upper Searches for the upper bound if true
+     * @return Returns the rank of the bound
+     */
+    int Bound(std::string_view pattern, bool upper) const
+    {
+        int m = (int) pattern.size();
+        int l = -1, r = size;
+        int matchL = 0, matchR = 0;
+
+        while (r - l > 1)
+        {
+            int mid = l + (r - l) / 2;
+            int pos = sa[mid];
+
+            // Both ends share this many characters with the pattern, and so does everything between them
+            int match = std::min(matchL, matchR);
+
+            while (match < m && pos + match < size && text[pos + match] == pattern[match])
+                match++;
+
+            bool before;
+
+            if (match == m)
+                before = upper;
+            else if (pos + match == size)
+                before = true;
+            else
+                before = (unsigned char) text[pos + match] < (unsigned char) pattern[match];
+
+            if (before)
+            {
+                l = mid;
+                matchL = match;
+            }
+            else
+            {
+                r = mid;
+                matchR = match;
+            }
+        }
+
+        return r;
+    }
+
+    public:
+    /**
+     * @brief MappedSuffixArray constructor and destructor
+     * @param textPath Path of the text file
+     * @param saPath Path of the SA file
+     * @param lcpPath Path of the LCP file
+     */
+    MappedSuffixArray(const std::string& textPath, const std::string& saPath, const std::string& lcpPath)
+    {
+        try
+        {
+            Open(textPath, textFile);
+            Open(saPath, saFile);
+            Open(lcpPath, lcpFile);
+        }
+        catch (...)
+        {
+            CloseAll();
+            throw;
+        }
+
+        if (textFile.size >= INT32_MAX || saFile.size != textFile.size * sizeof(int32_t) ||
+            lcpFile.size != saFile.size)
+        {
+            CloseAll();
+            throw "Invalid suffix array files";
+        }
+
+        text = (const char*) textFile.data;
+        sa = (const int32_t*) saFile.data;
+        lcp = (const int32_t*) lcpFile.data;
+        size = (int) textFile.size;
+
+        if (!IsValid())
+        {
+            CloseAll();
+            throw "Invalid suffix array files";
+        }
+    }
+
+    ~MappedSuffixArray()
+    {
+        CloseAll();
+    }
+
+    MappedSuffixArray(const MappedSuffixArray&) = delete;
+    MappedSuffixArray& operator=(const MappedSuffixArray&) = delete;
+
+    /**
+     * @brief The GetTextLength() function gets the length of the text.
+     * @return Returns the length of the mapped text
+     */
+    int GetTextLength() const
+    {
+        return size;
+    }
+
+    /**
+     * @brief The Sa() function reads an entry of the SA.
+     * @param i The rank of the suffix
+     * @return Returns the start of the suffix
+     */
+    int Sa(int i) const
+    {
+        return sa[i];
+    }
+
+    /**
+     * @brief The Lcp() function reads an entry of the LCP Array.
+     * @param i The rank of the suffix
+     * @return Returns the LCP of the suffix with the one before it
+     */
+    int Lcp(int i) const
+    {
+        return lcp[i];
+    }
+
+    /**
+     * @brief The Count() function counts the occurrences of a pattern in the text.
+     * @param pattern The pattern to search for
+     * @return Returns the number of occurrences
+     */
+    int Count(std::string_view pattern) const
+    {
+        return Bound(pattern, true) - Bound(pattern, false);
+    }
+
+    /**
+     * @brief The Locate() function finds every occurrence of a pattern in the text.
+     * @param pattern The pattern to search for
+     * @return Returns the start positions of the occurrences, in suffix order
+     */
+    SuffixRange Locate(std::string_view pattern) const
+    {
+        int first = Bound(pattern, false);
+        int last = Bound(pattern, true);
+
+        return { sa + first, last - first };
+    }
+
+    /**
+     * @brief The LongestRepeatedSubstring() function finds the longest substring that occurs at least
+     *      twice in the text.
+     * @return Returns a view into the mapped text, which is empty if no character repeats
+     */
+    std::string_view LongestRepeatedSubstring() const
+    {
+        int best = 0;
+
+        for (int i = 1; i < size; i++)
+        {
+            if (lcp[i] > lcp[best])
+                best = i;
+        }
+
+        return std::string_view(text + sa[best], lcp[best]);
+    }
+
+    /**
+     * @brief The DistinctSubstringCount() function counts the distinct non-empty substrings of the text.
+     * @return Returns the number of distinct substrings
+     */
+    long long DistinctSubstringCount() const
+    {
+        long long count = (long long) size * (size + 1) / 2;
+
+        for (int i = 0; i < size; i++)
+            count -= lcp[i];
+
+        return count;
+    }
+
+};
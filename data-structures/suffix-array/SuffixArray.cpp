@@ -1,6 +1,8 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <thread>
+#include <cstdio>
 
 #include "SuffixArray.h"
 
@@ -14,7 +16,8 @@
 /**
  * @brief SuffixArray constructor with char array as input
  */
-SuffixArray::SuffixArray(const char* text) 
+SuffixArray::SuffixArray(const char* text, SuffixArrayBuilder builder, int numThreads) 
+    : m_builder(builder), m_numThreads(std::max(1, numThreads))
 {
     if (strlen(text) == 0)
         throw "Text cannot be null";
@@ -28,7 +31,8 @@ SuffixArray::SuffixArray(const char* text)
 /**
  * @brief SuffixArray constructor with string as input
  */
-SuffixArray::SuffixArray(std::string& sText) 
+SuffixArray::SuffixArray(std::string& sText, SuffixArrayBuilder builder, int numThreads) 
+    : m_builder(builder), m_numThreads(std::max(1, numThreads))
 {
     if (sText.length() == 0)
         throw "Text cannot be null";
@@ -84,20 +88,286 @@ void SuffixArray::Kasai()
 }
 
 /**
- * @brief The BuildSuffixArray() function calls the Construct() function.
+ * @brief The Phi() function builds the LCP Array with the Phi algorithm, in place. The LCP Array first
+ *      holds Phi, whose entries are replaced by the PLCP one by one in text order, and is then permuted
+ *      into SA order by following the cycles of the SA.
+ */
+void SuffixArray::Phi() 
+{
+    int n = size;
+
+    lcp.assign(n, 0);
+
+    // Phi of every suffix is the suffix before it in the SA
+    ParallelFor(n, [&](int, int first, int last)
+    {
+        for (int j = first; j < last; j++)
+            lcp[sa[j]] = j == 0 ? -1 : sa[j - 1];
+    });
+
+    // The PLCP of i + 1 is at least that of i minus 1; every thread starts its chunk from scratch
+    ParallelFor(n, [&](int, int first, int last)
+    {
+        int len = 0;
+
+        for (int i = first; i < last; i++)
+        {
+            int previous = lcp[i];
+
+            if (previous == -1)
+            {
+                lcp[i] = len = 0;
+                continue;
+            }
+
+            while (i + len < n && previous + len < n && t[i + len] == t[previous + len])
+                len++;
+
+            lcp[i] = len;
+
+            if (len > 0)
+                len--;
+        }
+    });
+
+    // lcp[j] = plcp[sa[j]]: each slot is read by the step before it overwrites it. Visited entries of
+    // the SA are marked by flipping their bits, and restored afterwards
+    for (int start = 0; start < n; start++)
+    {
+        if (sa[start] < 0)
+            continue;
+
+        int saved = lcp[start];
+
+        for (int j = start; ; )
+        {
+            int next = sa[j];
+            sa[j] = ~next;
+
+            if (next == start)
+            {
+                lcp[j] = saved;
+                break;
+            }
+
+            lcp[j] = lcp[next];
+            j = next;
+        }
+    }
+
+    ParallelFor(n, [&](int, int first, int last)
+    {
+        for (int j = first; j < last; j++)
+            sa[j] = ~sa[j];
+    });
+}
+
+/**
+ * @brief The SparsePlcp() function computes the PLCP of every text position divisible by the sample
+ *      rate. Consecutive samples are 'sampleRate' positions apart, so each PLCP sample is at least the
+ *      previous one minus the sample rate.
+ */
+std::vector<int> SuffixArray::SparsePlcp(int sampleRate) 
+{
+    int n = size;
+    int samples = (n + sampleRate - 1) / sampleRate;
+    std::vector<int> plcp(samples);             // Sparse Phi, replaced by the sparse PLCP
+
+    ParallelFor(n, [&](int, int first, int last)
+    {
+        for (int j = first; j < last; j++)
+        {
+            if (sa[j] % sampleRate == 0)
+                plcp[sa[j] / sampleRate] = j == 0 ? -1 : sa[j - 1];
+        }
+    });
+
+    ParallelFor(samples, [&](int, int first, int last)
+    {
+        int len = 0;
+
+        for (int sample = first; sample < last; sample++)
+        {
+            int i = sample * sampleRate;
+            int previous = plcp[sample];
+
+            if (previous == -1)
+            {
+                plcp[sample] = len = 0;
+                continue;
+            }
+
+            while (i + len < n && previous + len < n && t[i + len] == t[previous + len])
+                len++;
+
+            plcp[sample] = len;
+            len = std::max(0, len - sampleRate);
+        }
+    });
+
+    return plcp;
+}
+
+/**
+ * @brief The LcpFromSparse() function computes one entry of the LCP Array from the sampled PLCP. The
+ *      sample at or before the suffix bounds its PLCP from below, and the rest is compared directly.
+ */
+int SuffixArray::LcpFromSparse(int j, const std::vector<int>& plcp, int sampleRate) 
+{
+    if (j == 0)
+        return 0;
+
+    int position = sa[j];
+    int previous = sa[j - 1];
+    int len = std::max(0, plcp[position / sampleRate] - position % sampleRate);
+
+    while (position + len < size && previous + len < size && t[position + len] == t[previous + len])
+        len++;
+
+    return len;
+}
+
+/**
+ * @brief The BuildLcpLr() function builds the LCP-LR arrays for every midpoint visited by the
+ *      binary search in Bound().
+ */
+void SuffixArray::BuildLcpLr() 
+{
+    if (constructedLcpLr)
+        return;
+
+    BuildLcpArray();
+    lcpLeft.assign(size, 0);
+    lcpRight.assign(size, 0);
+    FillLcpLr(-1, size);
+    constructedLcpLr = true;
+}
+
+/**
+ * @brief The FillLcpLr() function fills the LCP-LR entries of the search range (l, r). Every rank is
+ *      the midpoint of exactly one range, and the LCP of two ranks is the minimum of the LCP array
+ *      between them, so both halves are filled first and their results combined.
+ */
+int SuffixArray::FillLcpLr(int l, int r) 
+{
+    // The virtual suffixes at -1 and size share no prefix with anything, and lcp[0] is 0 as well
+    if (r - l == 1)
+        return r < size ? lcp[r] : 0;
+
+    int m = l + (r - l) / 2;
+
+    lcpLeft[m] = FillLcpLr(l, m);
+    lcpRight[m] = FillLcpLr(m, r);
+
+    return std::min(lcpLeft[m], lcpRight[m]);
+}
+
+/**
+ * @brief The Bound() function binary searches the SA for the first suffix that is not smaller than
+ *      the pattern, or with 'upper' set, the first suffix that is greater than it. The suffix at l
+ *      always sorts before the bound and the one at r at or after it; matchL and matchR hold their
+ *      LCP with the pattern. A midpoint whose LCP with the better matching end differs from that
+ *      end's match is decided without looking at the text.
+ */
+int SuffixArray::Bound(std::string_view pattern, bool upper) 
+{
+    BuildLcpLr();
+
+    int m = (int) pattern.size();
+    int l = -1, r = size;
+    int matchL = 0, matchR = 0;
+
+    while (r - l > 1)
+    {
+        int mid = l + (r - l) / 2;
+        int match;
+
+        if (matchL >= matchR)
+        {
+            // The midpoint agrees with l for longer than l agrees with the pattern, so it sorts like l
+            if (lcpLeft[mid] > matchL)
+            {
+                l = mid;
+                continue;
+            }
+
+            // The midpoint leaves l where l still matches the pattern, so it sorts after the pattern
+            if (lcpLeft[mid] < matchL)
+            {
+                r = mid;
+                matchR = lcpLeft[mid];
+                continue;
+            }
+
+            match = matchL;
+        }
+        else
+        {
+            if (lcpRight[mid] > matchR)
+            {
+                r = mid;
+                continue;
+            }
+
+            if (lcpRight[mid] < matchR)
+            {
+                l = mid;
+                matchL = lcpRight[mid];
+                continue;
+            }
+
+            match = matchR;
+        }
+
+        // Extend the match from where both ends left off
+        int pos = sa[mid];
+
+        while (match < m && pos + match < size && t[pos + match] == pattern[match])
+            match++;
+
+        bool before;
+
+        if (match == m)
+            before = upper;
+        else if (pos + match == size)
+            before = true;
+        else
+            before = (unsigned char) t[pos + match] < (unsigned char) pattern[match];
+
+        if (before)
+        {
+            l = mid;
+            matchL = match;
+        }
+        else
+        {
+            r = mid;
+            matchR = match;
+        }
+    }
+
+    return r;
+}
+
+/**
+ * @brief The BuildSuffixArray() function builds the Suffix Array with the chosen builder.
  */
 void SuffixArray::BuildSuffixArray() 
 {
     if (constructedSa)
         return;
 
-    Construct(t, size);
+    if (m_builder == SuffixArrayBuilder::PREFIX_DOUBLING)
+        ConstructPrefixDoubling();
+    else
+        ConstructSais();
+
     constructedSa = true;
 }
 
 /**
  * @brief The BuildLcpArray() function builds the LCP Array by building the Suffix
- *      Array and then running the Kasai algorithm.
+ *      Array and then running the chosen LCP builder.
  */
 void SuffixArray::BuildLcpArray() 
 {
@@ -105,43 +375,352 @@ void SuffixArray::BuildLcpArray()
         return;
 
     BuildSuffixArray();
-    Kasai();
+
+    if (m_lcpBuilder == LcpBuilder::PHI)
+    {
+        Phi();
+    }
+    else if (m_lcpBuilder == LcpBuilder::SPARSE_PHI)
+    {
+        std::vector<int> plcp = SparsePlcp(m_lcpSampleRate);
+
+        lcp.assign(size, 0);
+
+        ParallelFor(size, [&](int, int first, int last)
+        {
+            for (int j = first; j < last; j++)
+                lcp[j] = LcpFromSparse(j, plcp, m_lcpSampleRate);
+        });
+    }
+    else
+    {
+        Kasai();
+    }
+
     constructedLcpArray = true;
 }
 
 /**
- * @brief The Construct() function builds the Suffix Array.
+ * @brief The ConstructSais() function builds the Suffix Array with SA-IS.
+ */
+void SuffixArray::ConstructSais() 
+{
+    // Sort the text together with a virtual sentinel, which always ends up in front
+    TextSymbols symbols = { (const unsigned char*) t.data(), size };
+
+    sa.assign(size + 1, -1);
+    Sais(symbols, sa.data(), size + 1, 257);
+    sa.erase(sa.begin());
+}
+
+/**
+ * @brief The ConstructPrefixDoubling() function builds the Suffix Array by prefix doubling with
+ *      a parallel LSD radix sort.
+ */
+void SuffixArray::ConstructPrefixDoubling() 
+{
+    int n = size;
+    std::vector<int> rank(n);                   // Rank of the first k characters of every suffix
+    std::vector<int> tmp(n);                    // Radix sort buffer, then renaming flags
+
+    sa.resize(n);
+
+    // Ranks start as the characters themselves, shifted so that 0 can mean "past the end"
+    ParallelFor(n, [&](int, int first, int last)
+    {
+        for (int i = first; i < last; i++)
+        {
+            sa[i] = i;
+            rank[i] = (unsigned char) t[i] + 1;
+        }
+    });
+
+    int maxRank = 256;
+
+    for (int k = 1; ; k *= 2)
+    {
+        auto firstKey = [&rank](int i) { return rank[i]; };
+        auto secondKey = [&rank, k, n](int i) { return i + k < n ? rank[i + k] : 0; };
+        int digits = 0;
+
+        while (digits < 4 && (maxRank >> (8 * digits)) != 0)
+            digits++;
+
+        // LSD radix sort: every digit of the second key, then every digit of the first key
+        for (int d = 0; d < digits; d++)
+        {
+            RadixPass(sa, tmp, secondKey, 8 * d);
+            sa.swap(tmp);
+        }
+
+        for (int d = 0; d < digits; d++)
+        {
+            RadixPass(sa, tmp, firstKey, 8 * d);
+            sa.swap(tmp);
+        }
+
+        // Flag every position whose pair differs from the previous one, and count flags per chunk
+        std::vector<int> chunkSums(m_numThreads + 1, 0);
+
+        ParallelFor(n, [&](int thread, int first, int last)
+        {
+            int sum = 0;
+
+            for (int i = first; i < last; i++)
+            {
+                tmp[i] = (i == 0) || firstKey(sa[i]) != firstKey(sa[i - 1]) || 
+                    secondKey(sa[i]) != secondKey(sa[i - 1]);
+                sum += tmp[i];
+            }
+
+            chunkSums[thread + 1] = sum;
+        });
+
+        for (int i = 0; i < m_numThreads; i++)
+            chunkSums[i + 1] += chunkSums[i];
+
+        // The new rank of a suffix is the number of distinct pairs up to and including its own
+        ParallelFor(n, [&](int thread, int first, int last)
+        {
+            int current = chunkSums[thread];
+
+            for (int i = first; i < last; i++)
+            {
+                current += tmp[i];
+                rank[sa[i]] = current;
+            }
+        });
+
+        maxRank = chunkSums[m_numThreads];
+
+        if (maxRank == n)
+            break;
+    }
+}
+
+/**
+ * @brief The RadixPass() function stably sorts suffix positions by one 8 bit digit of a key,
+ *      splitting the work across threads.
+ */
+template <typename Key>
+void SuffixArray::RadixPass(const std::vector<int>& src, std::vector<int>& dst, const Key& key, int shift) 
+{
+    int n = (int) src.size();
+    std::vector<std::vector<int>> count(m_numThreads, std::vector<int>(256, 0));
+
+    // Every thread counts the digits of its own chunk
+    ParallelFor(n, [&](int thread, int first, int last)
+    {
+        std::vector<int>& local = count[thread];
+
+        for (int i = first; i < last; i++)
+            local[(key(src[i]) >> shift) & 255]++;
+    });
+
+    // Turn the counts into write positions; chunks keep their order within a bucket, so the pass is stable
+    for (int digit = 0, sum = 0; digit < 256; digit++)
+    {
+        for (int thread = 0; thread < m_numThreads; thread++)
+        {
+            int c = count[thread][digit];
+            count[thread][digit] = sum;
+            sum += c;
+        }
+    }
+
+    ParallelFor(n, [&](int thread, int first, int last)
+    {
+        std::vector<int>& local = count[thread];
+
+        for (int i = first; i < last; i++)
+            dst[local[(key(src[i]) >> shift) & 255]++] = src[i];
+    });
+}
+
+/**
+ * @brief The ParallelFor() function splits [0, n) into one contiguous chunk per thread and runs
+ *      'body' on every chunk.
+ */
+void SuffixArray::ParallelFor(int n, const std::function<void(int, int, int)>& body) 
+{
+    if (m_numThreads == 1)
+    {
+        body(0, 0, n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+
+    for (int thread = 0; thread < m_numThreads; thread++)
+    {
+        int first = (int) ((long long) n * thread / m_numThreads);
+        int last = (int) ((long long) n * (thread + 1) / m_numThreads);
+
+        threads.emplace_back(body, thread, first, last);
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+/**
+ * @brief The Sais() function sorts the suffixes of a string that ends in a unique, smallest
+ *      sentinel using the SA-IS algorithm.
  */
-std::vector<int> SuffixArray::Construct(std::string& t, int n) 
+template <typename Symbols>
+void SuffixArray::Sais(const Symbols& s, int* sa, int n, int alphabetSize) 
 {
-    suffixes.resize(n);
+    // Classify every suffix as S-type (true) or L-type (false); the sentinel is S-type
+    std::vector<bool> type(n);
+    type[n - 1] = true;
+
+    for (int i = n - 2; i >= 0; i--)
+        type[i] = s[i] < s[i + 1] || (s[i] == s[i + 1] && type[i + 1]);
+
+    auto isLms = [&type](int i) { return i > 0 && type[i] && !type[i - 1]; };
+    std::vector<int> bucket(alphabetSize);
+
+    // Sort the LMS substrings: drop LMS positions at the ends of their buckets, then induce
+    GetBuckets(s, bucket, n, true);
+    std::fill(sa, sa + n, -1);
+
+    for (int i = 1; i < n; i++)
+        if (isLms(i))
+            sa[--bucket[s[i]]] = i;
+
+    InduceL(s, type, sa, bucket, n);
+    InduceS(s, type, sa, bucket, n);
+
+    // Compact the sorted LMS substrings into the front of the array
+    int n1 = 0;
+
+    for (int i = 0; i < n; i++)
+        if (isLms(sa[i]))
+            sa[n1++] = sa[i];
+
+    // Name the LMS substrings; equal substrings get equal names
+    std::fill(sa + n1, sa + n, -1);
+    int name = 0;
+    int prev = -1;
 
-    for (int i = 0; i < n; i++) 
+    for (int i = 0; i < n1; i++)
     {
-        suffixes[i].index = i;
-        suffixes[i].suffix = t.substr((0 + i), (size - i));
+        int pos = sa[i];
+        bool diff = false;
+
+        for (int d = 0; d < n; d++)
+        {
+            if (prev == -1 || s[pos + d] != s[prev + d] || type[pos + d] != type[prev + d])
+            {
+                diff = true;
+                break;
+            }
+            else if (d > 0 && (isLms(pos + d) || isLms(prev + d)))
+                break;
+        }
+
+        if (diff)
+        {
+            name++;
+            prev = pos;
+        }
+
+        // LMS positions are at least two apart, so pos / 2 is a unique slot
+        sa[n1 + pos / 2] = name - 1;
     }
 
-    std::sort(suffixes.begin(), suffixes.end(), Compare);
+    // Gather the names in text order at the end of the array; this is the reduced string
+    for (int i = n - 1, j = n - 1; i >= n1; i--)
+        if (sa[i] >= 0)
+            sa[j--] = sa[i];
+
+    int* sa1 = sa;
+    int* s1 = sa + n - n1;
+
+    // Sort the reduced string, recursing only if some names repeat
+    if (name < n1)
+        Sais(IntSymbols { s1 }, sa1, n1, name);
+    else
+        for (int i = 0; i < n1; i++)
+            sa1[s1[i]] = i;
+
+    // Map the sorted reduced suffixes back to LMS positions in the text
+    for (int i = 1, j = 0; i < n; i++)
+        if (isLms(i))
+            s1[j++] = i;
+
+    for (int i = 0; i < n1; i++)
+        sa1[i] = s1[sa1[i]];
+
+    // Place the sorted LMS suffixes at the ends of their buckets and induce the rest
+    std::fill(sa + n1, sa + n, -1);
+    GetBuckets(s, bucket, n, true);
+
+    for (int i = n1 - 1; i >= 0; i--)
+    {
+        int j = sa[i];
+        sa[i] = -1;
+        sa[--bucket[s[j]]] = j;
+    }
+
+    InduceL(s, type, sa, bucket, n);
+    InduceS(s, type, sa, bucket, n);
+}
+
+/**
+ * @brief The GetBuckets() function computes the start or end of every symbol's bucket.
+ */
+template <typename Symbols>
+void SuffixArray::GetBuckets(const Symbols& s, std::vector<int>& bucket, int n, bool end) 
+{
+    std::fill(bucket.begin(), bucket.end(), 0);
 
     for (int i = 0; i < n; i++)
-        sa.emplace_back(suffixes[i].index);
+        bucket[s[i]]++;
 
-    return sa;
+    for (int c = 0, sum = 0; c < (int) bucket.size(); c++)
+    {
+        sum += bucket[c];
+        bucket[c] = end ? sum : sum - bucket[c];
+    }
 }
 
 /**
- * @brief The Compare() function compares two suffixes. If the first character that does
- *      not match between them has a lower value in suffix a than suffix b, it returns 1, 
- *      otherwise it returns 0.
+ * @brief The InduceL() function induces the order of the L-type suffixes from a left to right
+ *      scan of the partially filled suffix array.
  */
-int SuffixArray::Compare(Suffix& a, Suffix& b) 
+template <typename Symbols>
+void SuffixArray::InduceL(const Symbols& s, const std::vector<bool>& type, int* sa, 
+    std::vector<int>& bucket, int n) 
 {
-    // Make suffix strings comparable
-    const char* sufA = a.suffix.c_str();
-    const char* sufB = b.suffix.c_str();
+    GetBuckets(s, bucket, n, false);
+
+    for (int i = 0; i < n; i++)
+    {
+        int j = sa[i] - 1;
 
-    return strcmp(sufA, sufB) < 0 ? true : false;
+        if (j >= 0 && !type[j])
+            sa[bucket[s[j]]++] = j;
+    }
+}
+
+/**
+ * @brief The InduceS() function induces the order of the S-type suffixes from a right to left
+ *      scan of the suffix array.
+ */
+template <typename Symbols>
+void SuffixArray::InduceS(const Symbols& s, const std::vector<bool>& type, int* sa, 
+    std::vector<int>& bucket, int n) 
+{
+    GetBuckets(s, bucket, n, true);
+
+    for (int i = n - 1; i >= 0; i--)
+    {
+        int j = sa[i] - 1;
+
+        if (j >= 0 && type[j])
+            sa[--bucket[s[j]]] = j;
+    }
 }
 
 /**
@@ -152,10 +731,18 @@ int SuffixArray::GetTextLength()
     return size;
 }
 
+/**
+ * @brief The GetText() function gets the text input.
+ */
+const std::string& SuffixArray::GetText() 
+{
+    return t;
+}
+
 /**
  * @brief The GetSa() function calls the BuildSuffixArray() function.
  */
-std::vector<int> SuffixArray::GetSa() 
+const std::vector<int>& SuffixArray::GetSa() 
 {
     BuildSuffixArray();
 
@@ -165,7 +752,7 @@ std::vector<int> SuffixArray::GetSa()
 /**
  * @brief The GetLcpArray() function calls the BuildLcpArray() function.
  */
-std::vector<int> SuffixArray::GetLcpArray() 
+const std::vector<int>& SuffixArray::GetLcpArray() 
 {
     BuildLcpArray();
 
@@ -173,66 +760,223 @@ std::vector<int> SuffixArray::GetLcpArray()
 }
 
 /**
- * @brief The DisplayTable() function displays the Suffix and LCP Arrays in an easy to read
- *      format.
+ * @brief The SetLcpBuilder() function chooses how the LCP Array is built.
  */
-void SuffixArray::DisplayTable() 
+void SuffixArray::SetLcpBuilder(LcpBuilder builder, int sampleRate) 
 {
-    printf("-----i-----SA-----LCP---Suffix\n");
+    if (sampleRate <= 0)
+        throw "Sample rate 0 or less";
 
-    for (int i = 0; i < size; i++)
+    m_lcpBuilder = builder;
+    m_lcpSampleRate = sampleRate;
+    constructedLcpArray = false;
+    constructedLcpLr = false;
+}
+
+/**
+ * @brief The GetCompactLcpArray() function builds the LCP Array in one byte per entry with the sparse
+ *      Phi algorithm. Every thread collects the overflowing entries of its own chunk of ranks, and the
+ *      chunks are joined in order, which keeps the overflow table sorted.
+ */
+CompactLcpArray SuffixArray::GetCompactLcpArray(int sampleRate) 
+{
+    if (sampleRate <= 0)
+        throw "Sample rate 0 or less";
+
+    BuildSuffixArray();
+
+    std::vector<int> plcp = SparsePlcp(sampleRate);
+    std::vector<std::vector<std::pair<int, int>>> overflow(m_numThreads);
+    CompactLcpArray compact;
+
+    compact.values.resize(size);
+
+    ParallelFor(size, [&](int thread, int first, int last)
     {
-        const char* suf = suffixes[i].suffix.c_str();
-        printf("%6d %6d %6d %3s %s\n", i, sa[i], lcp[i], "", suf);
+        for (int j = first; j < last; j++)
+        {
+            int value = LcpFromSparse(j, plcp, sampleRate);
+
+            if (value >= CompactLcpArray::OVERFLOW_MARK)
+            {
+                compact.values[j] = CompactLcpArray::OVERFLOW_MARK;
+                overflow[thread].emplace_back(j, value);
+            }
+            else
+            {
+                compact.values[j] = (uint8_t) value;
+            }
+        }
+    });
+
+    for (const auto& entries : overflow)
+        compact.overflow.insert(compact.overflow.end(), entries.begin(), entries.end());
+
+    return compact;
+}
+
+/**
+ * @brief The Save() function writes the SA and LCP Array as raw int32 files.
+ */
+void SuffixArray::Save(const std::string& saPath, const std::string& lcpPath) 
+{
+    BuildLcpArray();
+
+    for (int file = 0; file < 2; file++)
+    {
+        const std::vector<int>& values = file == 0 ? sa : lcp;
+        FILE* out = fopen((file == 0 ? saPath : lcpPath).c_str(), "wb");
+
+        if (out == nullptr)
+            throw "Unable to create file";
+
+        size_t written = fwrite(values.data(), sizeof(int), values.size(), out);
+
+        if (fclose(out) != 0 || written != values.size())
+            throw "Unable to write file";
     }
 }
 
 /**
- * @brief The DisplaySA() function displays the Suffix Array in an easy to read format.
+ * @brief The Count() function counts the occurrences of a pattern in the text.
  */
-void SuffixArray::DisplaySA()
+int SuffixArray::Count(std::string_view pattern) 
 {
-    for (int i = 0; i < size; i++)
+    return Bound(pattern, true) - Bound(pattern, false);
+}
+
+/**
+ * @brief The Locate() function finds every occurrence of a pattern in the text. The suffixes that
+ *      start with the pattern are adjacent in the SA, so the result is a view of that block.
+ */
+SuffixRange SuffixArray::Locate(std::string_view pattern) 
+{
+    int first = Bound(pattern, false);
+    int last = Bound(pattern, true);
+
+    return { sa.data() + first, last - first };
+}
+
+/**
+ * @brief The LongestRepeatedSubstring() function finds the longest substring that occurs at least
+ *      twice in the text, which is the longest common prefix of two adjacent suffixes.
+ */
+std::string_view SuffixArray::LongestRepeatedSubstring() 
+{
+    BuildLcpArray();
+
+    int best = 0;
+
+    for (int i = 1; i < size; i++)
     {
-        const char* suf = suffixes[i].suffix.c_str();
-        printf("%d: %s\n", sa[i], suf);
+        if (lcp[i] > lcp[best])
+            best = i;
     }
+
+    return std::string_view(t.data() + sa[best], lcp[best]);
 }
 
-int main() 
+/**
+ * @brief The DistinctSubstringCount() function counts the distinct non-empty substrings of the
+ *      text. Every suffix contributes its prefixes, minus those it shares with the previous suffix.
+ */
+long long SuffixArray::DistinctSubstringCount() 
 {
-    char text[] = "transcendence";          // Char array to be sorted into Suffix/LCP Array
-    std::string sText = "follow";           // String to be sorted into Suffix/LCP Array
-    std::vector<int> sa;                    // Vector for Suffix Array storage
+    BuildLcpArray();
+
+    long long count = (long long) size * (size + 1) / 2;
+
+    for (int i = 0; i < size; i++)
+        count -= lcp[i];
+
+    return count;
+}
 
-    SuffixArray suffixArray(sText);
+/**
+ * @brief The LongestCommonSubstring() function finds the longest substring shared by the text and
+ *      another text. Both texts are sorted together as 'text 1 other 0', with bytes shifted up by two
+ *      so the separator and sentinel are unique and no common prefix can run across them. The answer
+ *      is the longest common prefix of two adjacent suffixes that start in different texts.
+ */
+std::string_view SuffixArray::LongestCommonSubstring(std::string_view other) 
+{
+    int n = size + (int) other.size() + 2;
+    std::vector<int> s(n);
 
-    // Sort data into Suffix Array
-    std::cout << "------------------------------------------------------" << std::endl;
-    std::cout << "Sorting data set..." << std::endl;
-    sa = suffixArray.GetLcpArray();
-    
-    if (sa.size() != 0) 
+    for (int i = 0; i < size; i++)
+        s[i] = (unsigned char) t[i] + 2;
+
+    s[size] = 1;
+
+    for (int i = 0; i < (int) other.size(); i++)
+        s[size + 1 + i] = (unsigned char) other[i] + 2;
+
+    s[n - 1] = 0;
+
+    std::vector<int> both(n);
+    std::vector<int> inv(n);
+    IntSymbols symbols = { s.data() };
+
+    Sais(symbols, both.data(), n, 258);
+
+    for (int i = 0; i < n; i++)
+        inv[both[i]] = i;
+
+    // Kasai over the combined text, keeping only the pairs that cross between the texts
+    int bestPos = 0, bestLength = 0;
+
+    for (int i = 0, len = 0; i < n; i++)
     {
-        std::cout << "Data set sorted! Printing values...\n{ ";
+        if (inv[i] == 0)
+        {
+            len = 0;
+            continue;
+        }
 
-        for (int i = 0; i < sa.size(); i++)
-            std::cout << sa[i] << " ";
+        int k = both[inv[i] - 1];
 
-        std::cout << "}" << std::endl;
+        while (i + len < n && k + len < n && s[i + len] == s[k + len])
+            len++;
+
+        if ((i < size) != (k < size) && len > bestLength)
+        {
+            bestLength = len;
+            bestPos = std::min(i, k);
+        }
+
+        if (len > 0)
+            len--;
     }
 
-    std::cout << "------------------------------------------------------" << std::endl;
+    return std::string_view(t.data() + bestPos, bestLength);
+}
 
-    // Print Suffix Array
-    std::cout << "------------------------------------------------------" << std::endl;
-    suffixArray.DisplaySA();
-    std::cout << "------------------------------------------------------" << std::endl;
+/**
+ * @brief The DisplayTable() function displays the Suffix and LCP Arrays in an easy to read
+ *      format.
+ */
+void SuffixArray::DisplayTable() 
+{
+    BuildLcpArray();
+    printf("-----i-----SA-----LCP---Suffix\n");
+
+    for (int i = 0; i < size; i++)
+    {
+        const char* suf = t.c_str() + sa[i];
+        printf("%6d %6d %6d %3s %s\n", i, sa[i], lcp[i], "", suf);
+    }
+}
 
-    // Print Suffix Array and LCP Array table
-    std::cout << "------------------------------------------------------" << std::endl;
-    suffixArray.DisplayTable();
-    std::cout << "------------------------------------------------------" << std::endl;
+/**
+ * @brief The DisplaySA() function displays the Suffix Array in an easy to read format.
+ */
+void SuffixArray::DisplaySA()
+{
+    BuildSuffixArray();
 
-    std::cin.get();
-}
\ No newline at end of file
+    for (int i = 0; i < size; i++)
+    {
+        const char* suf = t.c_str() + sa[i];
+        printf("%d: %s\n", sa[i], suf);
+    }
+}
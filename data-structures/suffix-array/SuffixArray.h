@@ -2,10 +2,13 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <string.h>
 #include <algorithm>
+#include <functional>
 
-#include "Suffix.h"
+#include "Symbols.h"
+#include "CompactLcpArray.h"
 
 /**
  * @file SuffixArray.h
@@ -13,73 +16,251 @@
  *      C++ conversion by 0xChristopher
  * @brief Suffix Array (SA) implementation which also builds a Longest Common Prefix Array (LCP)
  *      using the Kasai Algorithm. This implementation takes in a char[] as text to build the
- *      SA and LCP, and displays the result in an easy to digest table. The SA utilizes a
- *      naive method to build, and is achieved simply by comparing two suffixes of those 
- *      populated in an unsorted vector, and sorting based on those comparisons.
+ *      SA and LCP, and displays the result in an easy to digest table. The SA is built with the
+ *      SA-IS (induced sorting) algorithm, which works on the raw text: suffixes are classified as
+ *      S-type or L-type, the leftmost S-type (LMS) substrings are sorted by induction, named, and
+ *      the reduced string of names is solved recursively when names are not unique. The order of
+ *      the LMS suffixes then induces the order of every other suffix. No suffix is ever copied, and
+ *      besides the text and the 4n byte SA only a bit per position and the bucket counters are
+ *      needed. Suffixes are displayed straight from their offsets into the text.
+ *
+ *      Alternatively, the SA can be built by prefix doubling: every round sorts the suffixes by the
+ *      pair (rank of the first k characters, rank of the next k characters) with an LSD radix sort on
+ *      8 bit digits, then renames the pairs, doubling k until all ranks are distinct. Each radix pass
+ *      and each renaming is split across threads. It uses about 13n bytes against the roughly 5n
+ *      bytes of SA-IS, but its rounds scale with the number of cores. The builder is chosen through
+ *      the SuffixArrayBuilder strategy passed to the constructor.
+ *
+ *      Once built, the SA answers pattern queries. Count() and Locate() binary search the SA for the
+ *      block of suffixes that start with the pattern. The search keeps the LCP of the pattern with
+ *      both ends of the current range, and the LCP-LR arrays hold the LCP of every midpoint with the
+ *      ends of its range, so characters already matched are never compared again. Locate() returns
+ *      the block as a SuffixRange that points straight into the SA, so nothing is copied. The Kasai
+ *      LCP array also yields the longest repeated substring and the number of distinct substrings,
+ *      and the longest common substring with a second text is found from the SA of both texts.
+ *
+ *      The LCP Array is built by Kasai's algorithm unless another LcpBuilder is chosen with
+ *      SetLcpBuilder(). The Phi algorithm computes the LCP of every suffix in text order (the
+ *      permuted LCP, or PLCP) from Phi[sa[i]] = sa[i - 1], reusing the storage of the LCP Array for
+ *      Phi and PLCP and permuting it into SA order in place, so it needs 8n bytes against the 12n
+ *      bytes of Kasai. Chunks of the text are handed to separate threads, but the final permutation
+ *      follows cycles of the SA on one thread, so it trades time for memory.
+ *      The sparse variant only keeps the PLCP of every q-th text position, which bounds the PLCP of
+ *      the positions in between from below, and finishes each entry by direct comparison. The same
+ *      sparse pass also fills a CompactLcpArray of one byte per entry without ever materializing the
+ *      int LCP Array.
+ *
+ *      NOTE: Positions are stored as int, so the text must be shorter than 2^31 - 1 bytes.
  * 
  *      Time Complexity:
- *              Sorting                 O(n*k*logn)     where k is the max string length
+ *              SA-IS                   O(n)            to create the SA
+ *              Prefix Doubling         O(n*logn)       to create the SA, divided across threads
  *              Kasai's Algorithm       O(n)            to create LCP array
+ *              Phi Algorithm           O(n)            to create LCP array, divided across threads
+ *              Sparse Phi              O(n*q)          to create LCP array with PLCP sample rate q
+ *              LCP-LR                  O(n)            to create, once per text
+ *              Count/Locate            O(m + logn)     per pattern of length m
+ *              Longest common substring O(n + m)       against a text of length m
  */
 
+enum class SuffixArrayBuilder
+{
+    SAIS,                                       // Linear time induced sorting, single threaded
+    PREFIX_DOUBLING                             // Prefix doubling with parallel radix sort
+};
+
+enum class LcpBuilder
+{
+    KASAI,                                      // Kasai's algorithm with an inverse SA, 12n bytes
+    PHI,                                        // Phi algorithm in place, 8n bytes, multi-threaded
+    SPARSE_PHI                                  // Phi algorithm on sampled PLCP, 8n + 4n/q bytes
+};
+
+/**
+ * @brief A read only view of consecutive suffix array entries. It points into the SuffixArray that
+ *      produced it and stays valid for as long as that SuffixArray does.
+ */
+struct SuffixRange
+{
+
+    const int* first;                           // First entry of the range
+    int count;                                  // Number of entries in the range
+
+    const int* begin() const { return first; }
+    const int* end() const { return first + count; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    int operator[](int i) const { return first[i]; }
+
+};
+
 class SuffixArray 
 {
 
     private:
         bool constructedSa = false;             // Set to true if we have a Suffix Array
         bool constructedLcpArray = false;       // Set to true if we have an LCP Array
+        bool constructedLcpLr = false;          // Set to true if we have the LCP-LR arrays
+        SuffixArrayBuilder m_builder;           // Strategy used to build the Suffix Array
+        int m_numThreads;                       // Number of threads used by the prefix doubling builder
+        LcpBuilder m_lcpBuilder = LcpBuilder::KASAI;    // Strategy used to build the LCP Array
+        int m_lcpSampleRate = 32;               // PLCP sample rate of the sparse Phi builder
 
         /**
          * @brief The Kasai() function uses the Kasai algorithm to build the LCP Array.
          */
         void Kasai();
 
+        /**
+         * @brief The Phi() function builds the LCP Array with the Phi algorithm, in place.
+         */
+        void Phi();
+
+        /**
+         * @brief The SparsePlcp() function computes the PLCP of every text position divisible by the
+         *      sample rate.
+         * @param sampleRate The PLCP sample rate
+         * @return Returns the PLCP of positions 0, sampleRate, 2 * sampleRate, ...
+         */
+        std::vector<int> SparsePlcp(int sampleRate);
+
+        /**
+         * @brief The LcpFromSparse() function computes one entry of the LCP Array from the sampled PLCP.
+         * @param j The rank of the suffix
+         * @param plcp The sampled PLCP
+         * @param sampleRate The PLCP sample rate
+         * @return Returns the LCP of the suffix at rank j with the one before it
+         */
+        int LcpFromSparse(int j, const std::vector<int>& plcp, int sampleRate);
+
+        /**
+         * @brief The BuildLcpLr() function builds the LCP-LR arrays for every midpoint visited by the
+         *      binary search in Bound().
+         */
+        void BuildLcpLr();
+
+        /**
+         * @brief The FillLcpLr() function fills the LCP-LR entries of the search range (l, r).
+         * @param l The left end of the range, or -1 for the virtual smallest suffix
+         * @param r The right end of the range, or size for the virtual largest suffix
+         * @return Returns the LCP of the suffixes at ranks l and r
+         */
+        int FillLcpLr(int l, int r);
+
+        /**
+         * @brief The Bound() function binary searches the SA for the first suffix that is not smaller
+         *      than the pattern, or with 'upper' set, the first suffix that is greater than it. Only
+         *      the first |pattern| characters of every suffix are compared.
+         * @param pattern The pattern to search for
+         * @param upper Searches for the upper bound if true
+         * @return Returns the rank of the bound
+         */
+        int Bound(std::string_view pattern, bool upper);
+
     protected:
         int size;                               // Length of the suffix array
         std::string t;                          // Suffix Array input text
         std::vector<int> sa;                    // Sorted suffix array values
         std::vector<int> lcp;                   // Longest common prefix array
-        std::vector<Suffix> suffixes;           // All possible suffixes for given text
+        std::vector<int> lcpLeft;               // LCP of every search midpoint with the left end of its range
+        std::vector<int> lcpRight;              // LCP of every search midpoint with the right end of its range
 
         /**
-         * @brief The BuildSuffixArray() function calls the Construct() function.
+         * @brief The BuildSuffixArray() function builds the Suffix Array with the chosen builder.
          */
         void BuildSuffixArray();
 
         /**
          * @brief The BuildLcpArray() function builds the LCP Array by building the Suffix
-         *      Array and then running the Kasai algorithm.
+         *      Array and then running the chosen LCP builder.
          */
         void BuildLcpArray();
 
         /**
-         * @brief The Construct() function builds the Suffix Array.
-         * @param t The text the Suffix Array will be built with
-         * @param n The length of the text input
-         * @return Returns the Suffix Array
+         * @brief The ConstructSais() function builds the Suffix Array with SA-IS.
+         */
+        void ConstructSais();
+
+        /**
+         * @brief The ConstructPrefixDoubling() function builds the Suffix Array by prefix doubling with
+         *      a parallel LSD radix sort.
+         */
+        void ConstructPrefixDoubling();
+
+        /**
+         * @brief The RadixPass() function stably sorts suffix positions by one 8 bit digit of a key,
+         *      splitting the work across threads.
+         * @param src The positions to be sorted
+         * @param dst Receives the sorted positions
+         * @param key Returns the key of a position
+         * @param shift The position of the digit within the key
+         */
+        template <typename Key>
+        void RadixPass(const std::vector<int>& src, std::vector<int>& dst, const Key& key, int shift);
+
+        /**
+         * @brief The ParallelFor() function splits [0, n) into one contiguous chunk per thread and runs
+         *      'body' on every chunk.
+         * @param n The number of items
+         * @param body Called with the thread index and the chunk [first, last)
+         */
+        void ParallelFor(int n, const std::function<void(int, int, int)>& body);
+
+        /**
+         * @brief The Sais() function sorts the suffixes of a string that ends in a unique, smallest
+         *      sentinel using the SA-IS algorithm.
+         * @param s The string to be sorted
+         * @param sa Receives the sorted suffix positions; must hold n ints
+         * @param n The length of the string, including the sentinel
+         * @param alphabetSize The number of distinct symbol values; symbols lie in [0, alphabetSize)
+         */
+        template <typename Symbols>
+        static void Sais(const Symbols& s, int* sa, int n, int alphabetSize);
+
+        /**
+         * @brief The GetBuckets() function computes the start or end of every symbol's bucket.
+         * @param s The string being sorted
+         * @param bucket Receives the bucket boundaries
+         * @param n The length of the string
+         * @param end Computes bucket ends if true, and bucket starts otherwise
+         */
+        template <typename Symbols>
+        static void GetBuckets(const Symbols& s, std::vector<int>& bucket, int n, bool end);
+
+        /**
+         * @brief The InduceL() function induces the order of the L-type suffixes from a left to right
+         *      scan of the partially filled suffix array.
          */
-        std::vector<int> Construct(std::string& t, int n);
+        template <typename Symbols>
+        static void InduceL(const Symbols& s, const std::vector<bool>& type, int* sa, 
+            std::vector<int>& bucket, int n);
 
         /**
-         * @brief The Compare() function compares two suffixes. If the first character that does
-         *      not match between them has a lower value in suffix a than suffix b, it returns 1, 
-         *      otherwise it returns 0.
-         * @return Returns the result of suffix comparisons
+         * @brief The InduceS() function induces the order of the S-type suffixes from a right to left
+         *      scan of the suffix array.
          */
-        static int Compare(Suffix& a, Suffix& b);
+        template <typename Symbols>
+        static void InduceS(const Symbols& s, const std::vector<bool>& type, int* sa, 
+            std::vector<int>& bucket, int n);
 
     public:
         /**
          * @brief SuffixArray constructor with char array as input
          * @param text The input to build the SA and LCP with
+         * @param builder The strategy used to build the SA
+         * @param numThreads The number of threads used by the prefix doubling builder
          */
-        SuffixArray(const char* text);
+        SuffixArray(const char* text, SuffixArrayBuilder builder = SuffixArrayBuilder::SAIS, 
+            int numThreads = 1);
 
         /**
          * @brief SuffixArray constructor with string as input
          * @param sText The input to build the SA and LCP with
+         * @param builder The strategy used to build the SA
+         * @param numThreads The number of threads used by the prefix doubling builder
          */
-        SuffixArray(std::string& sText);
+        SuffixArray(std::string& sText, SuffixArrayBuilder builder = SuffixArrayBuilder::SAIS, 
+            int numThreads = 1);
 
         ~SuffixArray();
 
@@ -89,26 +270,93 @@ class SuffixArray
          */
         int GetTextLength();
 
+        /**
+         * @brief The GetText() function gets the text input.
+         * @return Returns the text the SA is built over
+         */
+        const std::string& GetText();
+
         /**
          * @brief The GetSa() function calls the BuildSuffixArray() function.
          * @return Returns the sorted suffix array values
          */
-        std::vector<int> GetSa();
+        const std::vector<int>& GetSa();
 
         /**
          * @brief The GetLcpArray() function calls the BuildLcpArray() function.
          * @return Returns the LCP Array
          */
-        std::vector<int> GetLcpArray();
+        const std::vector<int>& GetLcpArray();
+
+        /**
+         * @brief The SetLcpBuilder() function chooses how the LCP Array is built, and discards an LCP
+         *      Array built by another builder.
+         * @param builder The strategy used to build the LCP Array
+         * @param sampleRate The PLCP sample rate of the sparse Phi builder
+         */
+        void SetLcpBuilder(LcpBuilder builder, int sampleRate = 32);
+
+        /**
+         * @brief The GetCompactLcpArray() function builds the LCP Array in one byte per entry with the
+         *      sparse Phi algorithm, without building the int LCP Array.
+         * @param sampleRate The PLCP sample rate
+         * @return Returns the compact LCP Array
+         */
+        CompactLcpArray GetCompactLcpArray(int sampleRate = 32);
+
+        /**
+         * @brief The Save() function writes the SA and LCP Array as raw int32 files, which
+         *      MappedSuffixArray can map together with the text.
+         * @param saPath Path of the SA file to be written
+         * @param lcpPath Path of the LCP file to be written
+         */
+        void Save(const std::string& saPath, const std::string& lcpPath);
+
+        /**
+         * @brief The Count() function counts the occurrences of a pattern in the text.
+         * @param pattern The pattern to search for
+         * @return Returns the number of occurrences
+         */
+        int Count(std::string_view pattern);
+
+        /**
+         * @brief The Locate() function finds every occurrence of a pattern in the text.
+         * @param pattern The pattern to search for
+         * @return Returns the start positions of the occurrences, in suffix order
+         */
+        SuffixRange Locate(std::string_view pattern);
+
+        /**
+         * @brief The LongestRepeatedSubstring() function finds the longest substring that occurs at
+         *      least twice in the text.
+         * @return Returns a view into the text, which is empty if no character repeats
+         */
+        std::string_view LongestRepeatedSubstring();
+
+        /**
+         * @brief The DistinctSubstringCount() function counts the distinct non-empty substrings of
+         *      the text.
+         * @return Returns the number of distinct substrings
+         */
+        long long DistinctSubstringCount();
+
+        /**
+         * @brief The LongestCommonSubstring() function finds the longest substring shared by the text
+         *      and another text.
+         * @param other The text to compare against
+         * @return Returns a view into this SuffixArray's text, which is empty if nothing is shared
+         */
+        std::string_view LongestCommonSubstring(std::string_view other);
 
         /**
          * @brief The DisplayTable() function displays the Suffix and LCP Arrays in an easy to read
-         *      format.
+         *      format, printing each suffix from its offset into the text.
          */
         void DisplayTable();
 
         /**
-         * @brief The DisplaySA() function displays the Suffix Array in an easy to read format.
+         * @brief The DisplaySA() function displays the Suffix Array in an easy to read format, printing
+         *      each suffix from its offset into the text.
          */
         void DisplaySA();
     
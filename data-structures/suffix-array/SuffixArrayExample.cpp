@@ -0,0 +1,137 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <random>
+
+#include "SuffixArray.h"
+
+/**
+ * @file SuffixArrayExample.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the SuffixArray class. It lives apart from SuffixArray.cpp so that
+ *      other modules can compile SuffixArray.cpp into their own programs.
+ */
+
+int main() 
+{
+    char text[] = "transcendence";          // Char array to be sorted into Suffix/LCP Array
+    std::string sText = "follow";           // String to be sorted into Suffix/LCP Array
+    std::vector<int> sa;                    // Vector for Suffix Array storage
+
+    SuffixArray suffixArray(sText);
+
+    // Sort data into Suffix Array
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Sorting data set..." << std::endl;
+    sa = suffixArray.GetLcpArray();
+    
+    if (sa.size() != 0) 
+    {
+        std::cout << "Data set sorted! Printing values...\n{ ";
+
+        for (int i = 0; i < sa.size(); i++)
+            std::cout << sa[i] << " ";
+
+        std::cout << "}" << std::endl;
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Print Suffix Array
+    std::cout << "------------------------------------------------------" << std::endl;
+    suffixArray.DisplaySA();
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Print Suffix Array and LCP Array table
+    std::cout << "------------------------------------------------------" << std::endl;
+    suffixArray.DisplayTable();
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Answer pattern queries
+    std::string queryText = "abracadabra";
+    SuffixArray queries(queryText);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Text: " << queryText << std::endl;
+    std::cout << "Count(\"abra\"): " << queries.Count("abra") << std::endl;
+    std::cout << "Locate(\"a\"): { ";
+
+    for (int position : queries.Locate("a"))
+        std::cout << position << " ";
+
+    std::cout << "}" << std::endl;
+    std::cout << "Longest repeated substring: " << queries.LongestRepeatedSubstring() << std::endl;
+    std::cout << "Distinct substrings: " << queries.DistinctSubstringCount() << std::endl;
+    std::cout << "Longest common substring with \"cadaver\": " 
+        << queries.LongestCommonSubstring("cadaver") << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Compare the builders on a larger random text
+    int benchmarkLength = 5000000;
+    int numThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::mt19937 rng(42);
+    std::string benchmarkText(benchmarkLength, 'a');
+
+    for (int i = 0; i < benchmarkLength; i++)
+        benchmarkText[i] = 'a' + rng() % 4;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Building the SA of " << benchmarkLength << " random characters..." << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    SuffixArray sais(benchmarkText);
+    sais.GetSa();
+    auto end = std::chrono::steady_clock::now();
+
+    printf("SA-IS (1 thread): %.1f ms\n", std::chrono::duration<double, std::milli>(end - start).count());
+
+    start = std::chrono::steady_clock::now();
+    SuffixArray doubling(benchmarkText, SuffixArrayBuilder::PREFIX_DOUBLING, numThreads);
+    doubling.GetSa();
+    end = std::chrono::steady_clock::now();
+
+    printf("Prefix doubling (%d threads): %.1f ms\n", numThreads, 
+        std::chrono::duration<double, std::milli>(end - start).count());
+    std::cout << "Builders agree: " << (sais.GetSa() == doubling.GetSa() ? "yes" : "no") << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Compare the LCP builders on the same text
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Building the LCP Array of " << benchmarkLength << " random characters..." << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<int> kasai = sais.GetLcpArray();
+    end = std::chrono::steady_clock::now();
+
+    printf("Kasai (1 thread, 12n bytes): %.1f ms\n", std::chrono::duration<double, std::milli>(end - start).count());
+
+    doubling.SetLcpBuilder(LcpBuilder::PHI);
+    start = std::chrono::steady_clock::now();
+    bool phiAgrees = doubling.GetLcpArray() == kasai;
+    end = std::chrono::steady_clock::now();
+
+    printf("Phi (%d threads, 8n bytes): %.1f ms\n", numThreads, 
+        std::chrono::duration<double, std::milli>(end - start).count());
+
+    doubling.SetLcpBuilder(LcpBuilder::SPARSE_PHI, 16);
+    start = std::chrono::steady_clock::now();
+    bool sparseAgrees = doubling.GetLcpArray() == kasai;
+    end = std::chrono::steady_clock::now();
+
+    printf("Sparse Phi (%d threads, q = 16): %.1f ms\n", numThreads, 
+        std::chrono::duration<double, std::milli>(end - start).count());
+
+    start = std::chrono::steady_clock::now();
+    CompactLcpArray compact = doubling.GetCompactLcpArray(16);
+    end = std::chrono::steady_clock::now();
+
+    printf("Compact sparse Phi (%d threads, q = 16): %.1f ms, %.1f MB instead of %.1f MB\n", numThreads, 
+        std::chrono::duration<double, std::milli>(end - start).count(), compact.MemoryUsage() / 1048576.0,
+        kasai.size() * sizeof(int) / 1048576.0);
+    std::cout << "Builders agree: " << (phiAgrees && sparseAgrees ? "yes" : "no") << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
\ No newline at end of file
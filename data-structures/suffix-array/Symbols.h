@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * @file Symbols.h
+ * @author 0xChristopher
+ * @brief Symbol readers used by the SA-IS construction in SuffixArray. SA-IS needs its input to end in a
+ *      unique sentinel that is smaller than every other symbol, and it recurses on a reduced string of
+ *      integers. Both readers expose the same operator[] so a single templated builder serves every level
+ *      of the recursion without copying its input.
+ */
+
+struct TextSymbols
+{
+
+    const unsigned char* text;      // Input text
+    int length;                     // Length of the input text, excluding the sentinel
+
+    /**
+     * @brief Every byte is shifted up by one so that the virtual sentinel at 'length' can be 0.
+     * @param i Position in the text, in [0, length]
+     * @return Returns the symbol at position i
+     */
+    int operator[](int i) const
+    {
+        return i == length ? 0 : text[i] + 1;
+    }
+
+};
+
+struct IntSymbols
+{
+
+    const int* symbols;             // Reduced string produced by a previous level of the recursion
+
+    /**
+     * @param i Position in the reduced string
+     * @return Returns the symbol at position i
+     */
+    int operator[](int i) const
+    {
+        return symbols[i];
+    }
+
+};
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <string>
+#include <random>
+#include <chrono>
+
+#include "SuffixAutomaton.h"
+
+/**
+ * @file SuffixAutomaton.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the Suffix Automaton, and a comparison of its two transition layouts
+ */
+
+int main()
+{
+    SuffixAutomaton automaton;
+
+    // Feed the text in pieces, as a stream would
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Appending \"banana\" one character at a time..." << std::endl;
+
+    for (char ch : std::string("banana"))
+    {
+        automaton.Append(ch);
+        std::cout << "Text length " << automaton.Length() << ": " << automaton.DistinctSubstringCount() 
+            << " distinct substrings" << std::endl;
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Query the text so far
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Contains(\"nan\"): " << automaton.Contains("nan") << std::endl;
+    std::cout << "Contains(\"nab\"): " << automaton.Contains("nab") << std::endl;
+    std::cout << "Count(\"ana\"): " << automaton.Count("ana") << std::endl;
+
+    automaton.Append(" boat");
+
+    std::cout << "Appended \" boat\", Count(\"a\"): " << automaton.Count("a") << std::endl;
+    std::cout << "Distinct substrings: " << automaton.DistinctSubstringCount() << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Stream a long DNA text into both layouts
+    int textLength = 5000000;
+    std::mt19937 rng(42);
+    std::string dna(textLength, 'A');
+
+    for (char& base : dna)
+        base = "ACGT"[rng() % 4];
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Appending " << textLength << " random DNA bases..." << std::endl;
+
+    SuffixAutomaton sparse;
+    SuffixAutomaton compact("ACGT");
+
+    for (SuffixAutomaton* target : { &sparse, &compact })
+    {
+        auto start = std::chrono::steady_clock::now();
+        target->Append(dna);
+        auto end = std::chrono::steady_clock::now();
+
+        printf("%-16s %8.1f ms %10d states %8.1f MB %16lld distinct substrings\n", 
+            target == &sparse ? "Byte alphabet" : "ACGT alphabet", 
+            std::chrono::duration<double, std::milli>(end - start).count(), target->StateCount(),
+            target->MemoryUsage() / 1048576.0, target->DistinctSubstringCount());
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
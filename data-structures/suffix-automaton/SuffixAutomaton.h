@@ -0,0 +1,387 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+/**
+ * @file SuffixAutomaton.h
+ * @author 0xChristopher
+ * @brief Suffix Automaton (DAWG) implementation. The automaton is the smallest DFA that accepts every
+ *      substring of the text seen so far, and unlike the SuffixArray it is built online: Append() adds one
+ *      character at a time, so text can be fed in as it arrives. Every state stands for the set of
+ *      substrings that end at exactly the same positions of the text, with 'len' being the longest of them
+ *      and 'link' pointing at the state of its longest suffix that ends at more positions.
+ *
+ *      Each character adds len(last) - len(link(last)) new distinct substrings, so the number of distinct
+ *      substrings is kept up to date as the text grows. The number of occurrences of a state is the number
+ *      of prefixes of the text that end in it, which is summed up the suffix links on demand, once per
+ *      batch of appends.
+ *
+ *      Transitions are stored in one of two flat layouts:
+ *
+ *      - By default the alphabet is every byte, and the transitions of a state form a linked list of
+ *        Edge structs inside one shared array, so a state only pays for the edges it has.
+ *      - When the alphabet is given up front and is small (for example "ACGT"), every state owns a fixed
+ *        row of 'alphabetSize' targets in one flat array, so a transition is a single indexed load.
+ *
+ *      The automaton has at most 2n - 1 states and 3n - 4 transitions.
+ *
+ *      Time Complexity:
+ *              Append                  O(1) amortized for a fixed alphabet
+ *              Contains/Count          O(m) for a pattern of length m, plus O(n) once after appending
+ *              DistinctSubstringCount  O(1)
+ */
+
+class SuffixAutomaton
+{
+
+    private:
+        struct State
+        {
+            int len;                            // Length of the longest substring of the state
+            int link;                           // Suffix link, or -1 for the root
+            int firstEdge;                      // Head of the edge list (byte alphabet only)
+            int occurrences;                    // Number of end positions, valid once counted
+            bool isClone;                       // Clones are not the end of a new prefix
+        };
+
+        struct Edge
+        {
+            int target;                         // State reached by the transition
+            int next;                           // Next edge of the same state, or -1
+            int code;                           // Symbol code of the transition
+        };
+
+        static const int maxDenseAlphabet = 32; // Largest alphabet stored as dense rows
+
+        std::vector<State> states;              // All states; state 0 is the root
+        std::vector<Edge> edges;                // Edge lists of every state (byte alphabet)
+        std::vector<int> dense;                 // Row of targets per state (small alphabet)
+        int codes[256];                         // Symbol code of every byte, or -1 if not in the alphabet
+        int alphabetSize;                       // Number of symbol codes
+        bool isDense;                           // True if transitions are stored as dense rows
+        int last = 0;                           // State of the whole text
+        int length = 0;                         // Number of characters appended
+        long long distinct = 0;                 // Number of distinct non-empty substrings
+        bool countedOccurrences = true;         // Set to false by Append() until occurrences are recounted
+
+        /**
+         * @brief The NewState() function adds a state without any transitions.
+         * @param len Length of the longest substring of the state
+         * @param isClone True if the state is a clone
+         * @return Returns the index of the new state
+         */
+        int NewState(int len, bool isClone)
+        {
+            states.push_back({ len, -1, -1, isClone ? 0 : 1, isClone });
+
+            if (isDense)
+                dense.resize(dense.size() + alphabetSize, -1);
+
+            return (int) states.size() - 1;
+        }
+
+        /**
+         * @brief The Next() function follows a transition.
+         * @param state The state to leave
+         * @param code The symbol code of the transition
+         * @return Returns the target state, or -1 if there is no such transition
+         */
+        int Next(int state, int code) const
+        {
+            if (isDense)
+                return dense[(size_t) state * alphabetSize + code];
+
+            for (int e = states[state].firstEdge; e != -1; e = edges[e].next)
+            {
+                if (edges[e].code == code)
+                    return edges[e].target;
+            }
+
+            return -1;
+        }
+
+        /**
+         * @brief The SetNext() function adds a transition or redirects an existing one.
+         * @param state The state to leave
+         * @param code The symbol code of the transition
+         * @param target The new target state
+         */
+        void SetNext(int state, int code, int target)
+        {
+            if (isDense)
+            {
+                dense[(size_t) state * alphabetSize + code] = target;
+                return;
+            }
+
+            for (int e = states[state].firstEdge; e != -1; e = edges[e].next)
+            {
+                if (edges[e].code == code)
+                {
+                    edges[e].target = target;
+                    return;
+                }
+            }
+
+            edges.push_back({ target, states[state].firstEdge, code });
+            states[state].firstEdge = (int) edges.size() - 1;
+        }
+
+        /**
+         * @brief The CopyTransitions() function gives a clone the same transitions as its original.
+         * @param from The original state
+         * @param to The clone
+         */
+        void CopyTransitions(int from, int to)
+        {
+            if (isDense)
+            {
+                auto row = dense.begin() + (size_t) from * alphabetSize;
+                std::copy(row, row + alphabetSize, dense.begin() + (size_t) to * alphabetSize);
+                return;
+            }
+
+            for (int e = states[from].firstEdge; e != -1; e = edges[e].next)
+            {
+                edges.push_back({ edges[e].target, states[to].firstEdge, edges[e].code });
+                states[to].firstEdge = (int) edges.size() - 1;
+            }
+        }
+
+        /**
+         * @brief The Walk() function follows a pattern from the root.
+         * @param pattern The pattern to follow
+         * @return Returns the state reached, or -1 if the pattern is not a substring
+         */
+        int Walk(std::string_view pattern) const
+        {
+            int state = 0;
+
+            for (char ch : pattern)
+            {
+                int code = codes[(unsigned char) ch];
+
+                if (code == -1)
+                    return -1;
+
+                state = Next(state, code);
+
+                if (state == -1)
+                    return -1;
+            }
+
+            return state;
+        }
+
+        /**
+         * @brief The CountOccurrences() function sums the end positions of every state up its suffix
+         *      links, visiting states from the longest to the shortest with a counting sort on 'len'.
+         */
+        void CountOccurrences()
+        {
+            if (countedOccurrences)
+                return;
+
+            int n = (int) states.size();
+            std::vector<int> bucket(states[last].len + 2, 0);
+            std::vector<int> order(n);
+
+            for (int i = 0; i < n; i++)
+            {
+                states[i].occurrences = states[i].isClone || i == 0 ? 0 : 1;
+                bucket[states[i].len + 1]++;
+            }
+
+            for (int i = 1; i < (int) bucket.size(); i++)
+                bucket[i] += bucket[i - 1];
+
+            for (int i = 0; i < n; i++)
+                order[bucket[states[i].len]++] = i;
+
+            for (int i = n - 1; i > 0; i--)
+                states[states[order[i]].link].occurrences += states[order[i]].occurrences;
+
+            countedOccurrences = true;
+        }
+
+    public:
+        /**
+         * @brief SuffixAutomaton constructor over the full byte alphabet
+         */
+        SuffixAutomaton()
+            : alphabetSize(256), isDense(false)
+        {
+            for (int i = 0; i < 256; i++)
+                codes[i] = i;
+
+            NewState(0, false);
+        }
+
+        /**
+         * @brief SuffixAutomaton constructor over a given alphabet. Alphabets of up to 32 symbols are
+         *      stored as dense rows.
+         * @param alphabet Every character that may be appended
+         */
+        SuffixAutomaton(std::string_view alphabet)
+            : alphabetSize(0)
+        {
+            if (alphabet.empty())
+                throw "Empty alphabet";
+
+            std::fill(codes, codes + 256, -1);
+
+            for (char ch : alphabet)
+            {
+                if (codes[(unsigned char) ch] == -1)
+                    codes[(unsigned char) ch] = alphabetSize++;
+            }
+
+            isDense = alphabetSize <= maxDenseAlphabet;
+            NewState(0, false);
+        }
+
+        ~SuffixAutomaton()
+        {
+
+        }
+
+        /**
+         * @brief The Append() function extends the text by one character.
+         * @param ch The character to be appended
+         */
+        void Append(char ch)
+        {
+            int code = codes[(unsigned char) ch];
+
+            if (code == -1)
+                throw "Character not in alphabet";
+
+            int current = NewState(states[last].len + 1, false);
+            int p = last;
+
+            // Every suffix of the old text without this transition now reaches the new state
+            while (p != -1 && Next(p, code) == -1)
+            {
+                SetNext(p, code, current);
+                p = states[p].link;
+            }
+
+            if (p == -1)
+            {
+                states[current].link = 0;
+            }
+            else
+            {
+                int q = Next(p, code);
+
+                if (states[p].len + 1 == states[q].len)
+                {
+                    states[current].link = q;
+                }
+                else
+                {
+                    // q also holds longer substrings that do not end here, so split off the shorter ones
+                    int clone = NewState(states[p].len + 1, true);
+
+                    CopyTransitions(q, clone);
+                    states[clone].link = states[q].link;
+
+                    while (p != -1 && Next(p, code) == q)
+                    {
+                        SetNext(p, code, clone);
+                        p = states[p].link;
+                    }
+
+                    states[q].link = clone;
+                    states[current].link = clone;
+                }
+            }
+
+            last = current;
+            length++;
+            distinct += states[current].len - states[states[current].link].len;
+            countedOccurrences = false;
+        }
+
+        /**
+         * @brief The Append() function extends the text by a string of characters.
+         * @param text The characters to be appended
+         */
+        void Append(std::string_view text)
+        {
+            for (char ch : text)
+                Append(ch);
+        }
+
+        /**
+         * @brief The Contains() function checks if a pattern is a substring of the text.
+         * @param pattern The pattern to search for
+         * @return Returns true if the pattern occurs in the text
+         */
+        bool Contains(std::string_view pattern) const
+        {
+            return Walk(pattern) != -1;
+        }
+
+        /**
+         * @brief The Count() function counts the occurrences of a pattern in the text.
+         * @param pattern The pattern to search for
+         * @return Returns the number of occurrences
+         */
+        int Count(std::string_view pattern)
+        {
+            if (pattern.empty())
+                throw "Empty string";
+
+            int state = Walk(pattern);
+
+            if (state == -1)
+                return 0;
+
+            CountOccurrences();
+
+            return states[state].occurrences;
+        }
+
+        /**
+         * @brief The DistinctSubstringCount() function returns the number of distinct non-empty
+         *      substrings of the text.
+         * @return Returns the number of distinct substrings
+         */
+        long long DistinctSubstringCount() const
+        {
+            return distinct;
+        }
+
+        /**
+         * @brief The Length() function returns the length of the text.
+         * @return Returns the number of characters appended
+         */
+        int Length() const
+        {
+            return length;
+        }
+
+        /**
+         * @brief The StateCount() function returns the number of states, including the root.
+         * @return Returns the number of states
+         */
+        int StateCount() const
+        {
+            return (int) states.size();
+        }
+
+        /**
+         * @brief The MemoryUsage() function returns the bytes used by the states and transitions.
+         * @return Returns the memory footprint in bytes
+         */
+        size_t MemoryUsage() const
+        {
+            return states.capacity() * sizeof(State) + edges.capacity() * sizeof(Edge) +
+                dense.capacity() * sizeof(int);
+        }
+
+};
@@ -0,0 +1,152 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <cstdio>
+#include "ConcurrentTrie.h"
+
+/**
+ * @file ConcurrentTrie.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the ConcurrentTrie data structure, and a benchmark of its read
+ *        throughput for a growing number of reader threads while a writer keeps inserting new terms
+ */
+
+std::string keys[] = {"this", "that", "thankful", "solo"};          /// Strings to be added to the trie
+std::string removeKey = "that";                                     /// String to remove from the trie
+static int dictionaryWords = 200000;                                /// Words in the benchmark dictionary
+static double secondsPerRun = 0.5;                                  /// Duration of every benchmark run
+
+/**
+ * @brief The MakeWord() function builds a pronounceable word out of 2 to 4 syllables.
+ * @param rng The random number generator
+ * @return Returns the word
+ */
+std::string MakeWord(std::mt19937& rng) {
+    static const char* consonants = "bcdfghjklmnprstvwz";
+    static const char* vowels = "aeiou";
+    std::string word;
+    int syllables = 2 + rng() % 3;
+
+    for (int i = 0; i < syllables; i++) {
+        word += consonants[rng() % 18];
+        word += vowels[rng() % 5];
+    }
+
+    return word;
+}
+
+/**
+ * @brief The RunReaders() function looks up dictionary words from several threads while the main thread
+ *        inserts and removes new terms.
+ * @param trie The trie
+ * @param words The dictionary
+ * @param numReaders The number of reader threads
+ * @return Returns the number of lookups per second of all readers together
+ */
+double RunReaders(ConcurrentTrie& trie, const std::vector<std::string>& words, int numReaders) {
+    std::atomic<bool> stop(false);
+    std::atomic<long long> lookups(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < numReaders; i++) {
+        readers.emplace_back([&, i]() {
+            ConcurrentTrie::Reader reader(trie);
+            std::mt19937 rng(i);
+            long long done = 0, found = 0;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int j = 0; j < 256; j++)
+                    found += reader.Contains(words[rng() % words.size()]);
+
+                done += 256;
+            }
+
+            if (found != done)
+                std::cout << "A dictionary word went missing" << std::endl;
+
+            lookups += done;
+        });
+    }
+
+    /// The writer adds and drops terms that are not in the dictionary until the run is over
+    std::mt19937 rng(numReaders);
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::duration<double>(secondsPerRun);
+
+    while (std::chrono::steady_clock::now() < end) {
+        std::string term = "new" + MakeWord(rng);
+
+        if (rng() % 2 == 0)
+            trie.Insert(term);
+        else
+            trie.Remove(term);
+    }
+
+    stop = true;
+
+    for (auto& reader : readers)
+        reader.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return lookups / seconds;
+}
+
+int main() {
+    ConcurrentTrie trie;
+    ConcurrentTrie::Reader reader(trie);
+
+    /// @brief Insert keys and read them back through a Reader
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Inserting keys..." << std::endl;
+
+    for (auto& key : keys)
+        trie.Insert(key);
+
+    for (auto& key : keys)
+        std::cout << "\"" << key << "\" has count " << reader.Count(key) << std::endl;
+
+    std::cout << "Removing \"" << removeKey << "\"..." << std::endl;
+    trie.Remove(removeKey);
+
+    if (reader.Contains(removeKey))
+        std::cout << "The trie contains \"" << removeKey << "\"" << std::endl;
+    else
+        std::cout << "The trie doesn't contain \"" << removeKey << "\"" << std::endl;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    trie.Clear();
+
+    /// @brief Read throughput for a growing number of reader threads
+    std::mt19937 rng(42);
+    std::vector<std::string> words(dictionaryWords);
+
+    for (auto& word : words) {
+        word = MakeWord(rng);
+        trie.Insert(word);
+    }
+
+    int cores = (int) std::max(1u, std::thread::hardware_concurrency());
+    double single = 0;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    printf("%zu nodes, %d hardware threads\n", trie.NodeCount(), cores);
+
+    for (int numReaders = 1; numReaders <= 2 * cores; numReaders *= 2) {
+        double rate = RunReaders(trie, words, numReaders);
+
+        if (numReaders == 1)
+            single = rate;
+
+        printf("%2d readers: %6.2f M lookups/s (%.2fx of one reader)\n", numReaders, rate / 1e6, rate / single);
+    }
+
+    printf("%zu retired allocations waiting for reclamation\n", trie.PendingReclaims());
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
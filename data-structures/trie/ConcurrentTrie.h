@@ -0,0 +1,505 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+/**
+ * @file ConcurrentTrie.h
+ * @author 0xChristopher
+ * @brief The ConcurrentTrie class is a Trie for many reader threads and few writers, with the same Insert(),
+ *        Remove(), Contains() and Count() semantics as Trie. Readers never take a lock or write to shared
+ *        memory besides their own slot, so read throughput grows with the number of cores.
+ *
+ *        The children of a node are an immutable table of sorted key bytes and node pointers. A writer never
+ *        changes a published table: adding or cutting a child builds a new table and publishes it with a
+ *        single atomic store, the read-copy-update (RCU) pattern, so a reader sees either the old or the new
+ *        table and both are complete. Counts and word-ending flags are atomics that writers update in place.
+ *        Writers are serialized by a mutex.
+ *
+ *        Replaced tables and removed nodes may still be in use by readers, so their deletion is deferred by
+ *        epoch-based reclamation. Every reader owns a slot (see ConcurrentTrie::Reader) in which it announces
+ *        the global epoch when it starts a lookup and clears it when done. A writer tags the memory it
+ *        unlinks with the current epoch, advances the epoch, and deletes what is tagged before the oldest
+ *        epoch any reader still announces.
+ *
+ *        NOTE: A lookup that runs while a key is inserted or removed may see some of the count updates of
+ *        that key and not others, like any reader of a structure that is updated concurrently.
+ *
+ *        Time Complexity:
+ *              Operation       Average     Best
+ *              Insertion       O(n*d)      O(n)        where d is the number of children of a node
+ *              Deletion        O(n*d)      O(n)
+ *              Search          O(n*log(d)) O(1)
+ */
+
+class ConcurrentTrie {
+
+    private:
+        struct Node;
+
+        /// Immutable children of a node, allocated as one block: the header, then the node pointers, then
+        /// the sorted key bytes. The header is pointer aligned, so the pointers after it are too
+        struct alignas(Node*) ChildTable {
+            int size;                               /// Number of children
+
+            Node** Children() {
+                return (Node**) (this + 1);
+            }
+
+            uint8_t* Keys() {
+                return (uint8_t*) (Children() + size);
+            }
+        };
+
+        struct Node {
+            std::atomic<int> count { 0 };           /// The number of strings/insertions a node belongs to
+            std::atomic<bool> isWordEnding { false };   /// Is true if node represents the end of a word
+            std::atomic<ChildTable*> children { nullptr };  /// Children of the node, or nullptr if none
+        };
+
+        /// Memory unlinked by a writer, waiting until no reader can hold it anymore
+        struct Retired {
+            uint64_t epoch;                         /// Global epoch after the memory was unlinked
+            Node* node;                             /// Removed node, or nullptr
+            ChildTable* table;                      /// Replaced table, or nullptr
+        };
+
+        /// Epoch announcement of one reader, on its own cache line so readers never share one
+        struct alignas(64) Slot {
+            std::atomic<uint64_t> epoch { IDLE };   /// Epoch announced by the reader, or IDLE
+            std::atomic<bool> taken { false };      /// Is true while a Reader owns the slot
+        };
+
+        static constexpr uint64_t IDLE = UINT64_MAX;    /// Announced epoch of a reader outside of a lookup
+        static constexpr size_t RECLAIM_BATCH = 64;     /// Retired allocations that trigger a reclamation
+
+        Node* root = new Node();                    /// Root node of the Trie
+        std::atomic<uint64_t> globalEpoch { 1 };    /// Current epoch
+        std::unique_ptr<Slot[]> slots;              /// Epoch slots of the readers
+        int maxReaders;                             /// Number of slots
+        std::mutex writeLock;                       /// Serializes the writers
+        std::vector<Retired> retired;               /// Memory waiting to be deleted, oldest first
+        std::atomic<size_t> numNodes { 0 };         /// Number of nodes below the root
+
+        /**
+         * @brief The NewTable() function allocates a table of children.
+         * @param size The number of children
+         * @return Returns the table
+         */
+        static ChildTable* NewTable(int size) {
+            void* memory = ::operator new(sizeof(ChildTable) + size * (sizeof(Node*) + 1));
+            ChildTable* table = new (memory) ChildTable();
+            table->size = size;
+
+            return table;
+        }
+
+        /**
+         * @brief The DeleteTable() function frees a table of children.
+         * @param table The table, which may be nullptr
+         */
+        static void DeleteTable(ChildTable* table) {
+            ::operator delete(table);
+        }
+
+        /**
+         * @brief The Find() function looks up the child of a byte in a table.
+         * @param table The table, which may be nullptr
+         * @param c The byte of the child
+         * @return Returns the child, or nullptr if there is none
+         */
+        static Node* Find(ChildTable* table, uint8_t c) {
+            if (table == nullptr)
+                return nullptr;
+
+            uint8_t* keys = table->Keys();
+            int first = 0, last = table->size;
+
+            /// Scan small tables, binary search large ones
+            if (last > 16) {
+                first = (int) (std::lower_bound(keys, keys + last, c) - keys);
+                last = std::min(last, first + 1);
+            }
+
+            for (int i = first; i < last; i++) {
+                if (keys[i] == c)
+                    return table->Children()[i];
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * @brief The WithChild() function copies a table with one child added.
+         * @param table The table, which may be nullptr
+         * @param c The byte of the new child
+         * @param child The new child
+         * @return Returns the new table
+         */
+        static ChildTable* WithChild(ChildTable* table, uint8_t c, Node* child) {
+            int size = table == nullptr ? 0 : table->size;
+            ChildTable* copy = NewTable(size + 1);
+            int j = 0;
+
+            for (int i = 0; i <= size; i++) {
+                if (j == i && (i == size || table->Keys()[i] > c)) {
+                    copy->Keys()[j] = c;
+                    copy->Children()[j++] = child;
+                }
+
+                if (i < size) {
+                    copy->Keys()[j] = table->Keys()[i];
+                    copy->Children()[j++] = table->Children()[i];
+                }
+            }
+
+            return copy;
+        }
+
+        /**
+         * @brief The WithoutChild() function copies a table with one child removed.
+         * @param table The table
+         * @param c The byte of the child to be removed
+         * @return Returns the new table, or nullptr if no children are left
+         */
+        static ChildTable* WithoutChild(ChildTable* table, uint8_t c) {
+            if (table->size == 1)
+                return nullptr;
+
+            ChildTable* copy = NewTable(table->size - 1);
+
+            for (int i = 0, j = 0; i < table->size; i++) {
+                if (table->Keys()[i] != c) {
+                    copy->Keys()[j] = table->Keys()[i];
+                    copy->Children()[j++] = table->Children()[i];
+                }
+            }
+
+            return copy;
+        }
+
+        /**
+         * @brief The RetireSubtree() function hands a node and everything below it to the reclamation.
+         * @param node The subtree root, which must already be unlinked
+         */
+        void RetireSubtree(Node* node) {
+            std::vector<Node*> stack = { node };
+            uint64_t epoch = globalEpoch.load();
+
+            while (!stack.empty()) {
+                Node* current = stack.back();
+                stack.pop_back();
+                ChildTable* table = current->children.load(std::memory_order_relaxed);
+
+                if (table != nullptr) {
+                    stack.insert(stack.end(), table->Children(), table->Children() + table->size);
+                    retired.push_back({ epoch, nullptr, table });
+                }
+
+                retired.push_back({ epoch, current, nullptr });
+                numNodes.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief The Reclaim() function advances the epoch and deletes the retired memory that no reader can
+         *        reach anymore, once enough has been retired to be worth a scan of the reader slots.
+         */
+        void Reclaim() {
+            if (retired.size() < RECLAIM_BATCH)
+                return;
+
+            /// The unlinking stores must be visible before the reader slots are read
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            uint64_t oldest = globalEpoch.fetch_add(1) + 1;
+
+            for (int i = 0; i < maxReaders; i++)
+                oldest = std::min(oldest, slots[i].epoch.load());
+
+            /// A reader that announced epoch e may hold anything unlinked while the epoch was e or later
+            size_t freed = 0;
+
+            while (freed < retired.size() && retired[freed].epoch < oldest) {
+                delete retired[freed].node;
+                DeleteTable(retired[freed].table);
+                freed++;
+            }
+
+            retired.erase(retired.begin(), retired.begin() + freed);
+        }
+
+        /**
+         * @brief The FreeAll() function deletes a subtree at once, when no reader can be active.
+         * @param node The subtree root
+         */
+        static void FreeAll(Node* node) {
+            std::vector<Node*> stack = { node };
+
+            while (!stack.empty()) {
+                Node* current = stack.back();
+                stack.pop_back();
+                ChildTable* table = current->children.load(std::memory_order_relaxed);
+
+                if (table != nullptr) {
+                    stack.insert(stack.end(), table->Children(), table->Children() + table->size);
+                    DeleteTable(table);
+                }
+
+                delete current;
+            }
+        }
+
+        /**
+         * @brief The CountFrom() function follows a key from the root without taking any lock.
+         * @param key The key
+         * @return Returns the count of the prefix
+         */
+        int CountFrom(std::string_view key) {
+            if (key.empty())
+                throw "Empty string";
+
+            Node* node = root;
+
+            for (char ch : key) {
+                node = Find(node->children.load(std::memory_order_acquire), (uint8_t) ch);
+
+                if (node == nullptr)
+                    return 0;
+            }
+
+            return node->count.load(std::memory_order_relaxed);
+        }
+
+    public:
+        /**
+         * @brief The Reader class is the handle a thread looks keys up through. It owns an epoch slot of the
+         *        trie for its lifetime, so every reader thread should create its own and keep it.
+         */
+        class Reader {
+
+            private:
+                ConcurrentTrie& trie;               /// The trie being read
+                Slot& slot;                         /// Epoch slot of the reader
+
+                /**
+                 * @brief The Claim() function takes the first free epoch slot of a trie.
+                 * @param trie The trie
+                 * @return Returns the slot
+                 */
+                static Slot& Claim(ConcurrentTrie& trie) {
+                    for (int i = 0; i < trie.maxReaders; i++) {
+                        bool expected = false;
+
+                        if (trie.slots[i].taken.compare_exchange_strong(expected, true))
+                            return trie.slots[i];
+                    }
+
+                    throw "Too many readers";
+                }
+
+            public:
+                /**
+                 * @brief Reader constructor and destructor
+                 * @param trie The trie to be read
+                 */
+                Reader(ConcurrentTrie& trie)
+                    : trie(trie), slot(Claim(trie)) {}
+
+                ~Reader() {
+                    slot.taken.store(false);
+                }
+
+                Reader(const Reader&) = delete;
+                Reader& operator=(const Reader&) = delete;
+
+                /**
+                 * @brief The Count() function gets the count value of a node based on the prefix (key)
+                 * @param key The string to check the count of
+                 * @return Returns the count of the prefix
+                 */
+                int Count(std::string_view key) {
+                    if (key.empty())
+                        throw "Empty string";
+
+                    /// The announcement must be visible before any node of the trie is read
+                    slot.epoch.store(trie.globalEpoch.load());
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    int count = trie.CountFrom(key);
+                    slot.epoch.store(IDLE, std::memory_order_release);
+
+                    return count;
+                }
+
+                /**
+                 * @brief The Contains() function checks if a string (key) is contained within the trie.
+                 * @param key The string to be checked
+                 * @return Returns true if the string (key) is contained within the trie
+                 */
+                bool Contains(std::string_view key) {
+                    return Count(key) != 0;
+                }
+
+        };
+
+        /**
+         * @brief ConcurrentTrie constructor and destructor
+         * @param maxReaders The largest number of Reader handles that may exist at the same time
+         */
+        ConcurrentTrie(int maxReaders = 256)
+            : slots(new Slot[maxReaders]), maxReaders(maxReaders) {}
+
+        /// No Reader may be left when the trie is destroyed
+        ~ConcurrentTrie() {
+            for (Retired& item : retired) {
+                delete item.node;
+                DeleteTable(item.table);
+            }
+
+            FreeAll(root);
+        }
+
+        ConcurrentTrie(const ConcurrentTrie&) = delete;
+        ConcurrentTrie& operator=(const ConcurrentTrie&) = delete;
+
+        /**
+         * @brief The Insert() function attempts to insert a string of characters into the trie.
+         * @param key The string to be inserted
+         * @return Returns true upon successful insertion
+         */
+        bool Insert(std::string_view key) {
+            if (key.empty())
+                throw "Empty string";
+
+            std::lock_guard<std::mutex> lock(writeLock);
+            Node* node = root;
+            bool createdNewNode = false;
+            bool isPrefix = false;
+
+            for (char ch : key) {
+                ChildTable* table = node->children.load(std::memory_order_relaxed);
+                Node* nextNode = Find(table, (uint8_t) ch);
+
+                /// Publish a copy of the table with the new child, then retire the old table
+                if (nextNode == nullptr) {
+                    nextNode = new Node();
+                    node->children.store(WithChild(table, (uint8_t) ch, nextNode), std::memory_order_release);
+                    numNodes.fetch_add(1, std::memory_order_relaxed);
+                    createdNewNode = true;
+
+                    if (table != nullptr)
+                        retired.push_back({ globalEpoch.load(), nullptr, table });
+                } else if (nextNode->isWordEnding.load(std::memory_order_relaxed)) {
+                    isPrefix = true;
+                }
+
+                node = nextNode;
+                node->count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            node->isWordEnding.store(true, std::memory_order_relaxed);
+            Reclaim();
+
+            return isPrefix || !createdNewNode;
+        }
+
+        /**
+         * @brief The Remove() function attempts to remove a string from the trie.
+         * @param key The string to be removed
+         * @return Returns true upon successful removal
+         */
+        bool Remove(std::string_view key) {
+            std::lock_guard<std::mutex> lock(writeLock);
+
+            if (CountFrom(key) == 0)
+                return false;
+
+            Node* node = root;
+
+            for (char ch : key) {
+                ChildTable* table = node->children.load(std::memory_order_relaxed);
+                Node* currentNode = Find(table, (uint8_t) ch);
+
+                /// Cut this edge if the current node has a count <= 0
+                /// This means that all the prefixes below this point are inaccessible
+                if (currentNode->count.fetch_sub(1, std::memory_order_relaxed) <= 1) {
+                    node->children.store(WithoutChild(table, (uint8_t) ch), std::memory_order_release);
+                    retired.push_back({ globalEpoch.load(), nullptr, table });
+                    RetireSubtree(currentNode);
+                    break;
+                }
+
+                node = currentNode;
+            }
+
+            Reclaim();
+
+            return true;
+        }
+
+        /**
+         * @brief The Count() function gets the count value of a node based on the prefix (key). It is meant
+         *        for writer threads; reader threads use a Reader.
+         * @param key The string to check the count of
+         * @return Returns the count of the prefix
+         */
+        int Count(std::string_view key) {
+            std::lock_guard<std::mutex> lock(writeLock);
+
+            return CountFrom(key);
+        }
+
+        /**
+         * @brief The Contains() function checks if a string (key) is contained within the trie. It is meant
+         *        for writer threads; reader threads use a Reader.
+         * @param key The string to be checked
+         * @return Returns true if the string (key) is contained within the trie
+         */
+        bool Contains(std::string_view key) {
+            return Count(key) != 0;
+        }
+
+        /**
+         * @brief The Clear() function unlinks all nodes, which are deleted once no reader holds them.
+         */
+        void Clear() {
+            std::lock_guard<std::mutex> lock(writeLock);
+            ChildTable* table = root->children.exchange(nullptr, std::memory_order_acq_rel);
+
+            if (table != nullptr) {
+                for (int i = 0; i < table->size; i++)
+                    RetireSubtree(table->Children()[i]);
+
+                retired.push_back({ globalEpoch.load(), nullptr, table });
+            }
+
+            Reclaim();
+        }
+
+        /**
+         * @brief The NodeCount() function returns the number of nodes below the root.
+         * @return Returns the number of nodes
+         */
+        size_t NodeCount() {
+            return numNodes.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief The PendingReclaims() function returns the number of retired nodes and tables that readers
+         *        may still hold.
+         * @return Returns the number of allocations waiting to be deleted
+         */
+        size_t PendingReclaims() {
+            std::lock_guard<std::mutex> lock(writeLock);
+
+            return retired.size();
+        }
+
+};
@@ -0,0 +1,447 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../trie/Node.h"
+
+/**
+ * @file DoubleArrayTrie.h
+ * @author 0xChristopher
+ * @brief The DoubleArrayTrie class is a static, read-optimized copy of a Trie, created by Trie::Freeze().
+ *        Every node becomes a state, which is a slot in two parallel arrays, BASE and CHECK. The child of
+ *        state s for byte c lives in slot t = BASE[s] + code(c), and it exists only if CHECK[t] == s, so
+ *        following a character costs two array reads. BASE and CHECK are interleaved, so CHECK[t] and the
+ *        BASE[t] needed for the next character share a cache line. A third array keeps the count and
+ *        word-ending flag of each state.
+ *
+ *        Freezing places the states depth first, which keeps the states along a key close together in the
+ *        arrays. The children of a state are given the first BASE that puts all of them in free slots, and
+ *        free slots are kept in a linked list so the search skips the filled ones. A free slot that failed
+ *        to fit MAX_FAILURES times is no longer tried first, which keeps the search short at the cost of
+ *        leaving a few slots empty. The arrays are padded so that BASE[s] + code(c) never runs past the end.
+ *
+ *        All arrays live in one buffer with a small header, so Save() writes the buffer as is, and a saved
+ *        file is queried by memory mapping it without any parsing. Opening a file checks every slot in use
+ *        once, so that no transition of a corrupt file leads outside the arrays.
+ *
+ *        NOTE: Loading a saved trie relies on the POSIX mmap() interface.
+ *
+ *        File Layout:
+ *              Header          sizeof(DoubleArrayTrieHeader) bytes
+ *              Units           Unit[units]         BASE and CHECK of every slot
+ *              Values          uint32_t[units]     count and word-ending flag of every slot
+ *
+ *        Time Complexity:
+ *              Operation       Average     Best
+ *              Freeze          O(n*k)      O(n)        where k is the number of slots tried per state
+ *              Search          O(m)        O(1)        where m is the length of the key
+ */
+
+/**
+ * @brief The DoubleArrayTrieHeader struct starts every DoubleArrayTrie buffer and file.
+ */
+struct DoubleArrayTrieHeader {
+    static constexpr uint64_t MAGIC = 0x3130454952544144ULL;   /// "DATRIE01" tag used to validate a file
+    static constexpr uint64_t VERSION = 2;                      /// Current file format version
+
+    uint64_t magic = MAGIC;                         /// Must equal MAGIC
+    uint64_t version = VERSION;                     /// Must equal VERSION
+    uint64_t units = 0;                             /// Number of slots, including the padding
+    uint64_t states = 0;                            /// Number of slots in use, including the root
+
+    /**
+     * @brief The FileSize() function returns the size of a buffer with this header, padded to a whole
+     *        number of 8 byte words.
+     * @return Returns the size in bytes
+     */
+    uint64_t FileSize() const {
+        return (sizeof(DoubleArrayTrieHeader) + units * 12 + 7) / 8 * 8;
+    }
+};
+
+class DoubleArrayTrie {
+    friend class Trie;
+
+    public:
+        static const uint32_t WORD_ENDING = 0x80000000u;    /// Value bit of a state that ends a word
+        static const uint32_t COUNT_MASK = 0x7FFFFFFFu;     /// Value bits of the count of a state
+        static const int CODES = 256;                       /// Number of transition codes, one per byte
+        static const int MAX_FAILURES = 16;                 /// Failed fits before Freeze() skips a free slot
+
+        struct Unit {
+            int32_t base;                           /// Offset of the children of the state
+            int32_t check;                          /// Parent state of the slot, or -1 if the slot is free
+        };
+
+    private:
+        std::vector<uint64_t> storage;              /// Buffer of a frozen trie built in memory
+        int fd = -1;                                /// File descriptor of a mapped file
+        void* mapping = nullptr;                    /// Start of the memory mapping
+        size_t mappingSize = 0;                     /// Size of the memory mapping in bytes
+        const DoubleArrayTrieHeader* header = nullptr;  /// Header of the buffer
+        const Unit* units = nullptr;                /// BASE and CHECK of every slot
+        const uint32_t* values = nullptr;           /// Count and word-ending flag of every slot
+
+        /**
+         * @brief The Code() function maps a character to its transition code. Codes start at 1, so no
+         *        transition ever leads back to the root in slot 0.
+         * @param c The character
+         * @return Returns the code of the character
+         */
+        static int Code(char c) {
+            return (unsigned char) c + 1;
+        }
+
+        /**
+         * @brief DoubleArrayTrie constructor from the node arena of a Trie, used by Trie::Freeze()
+         * @param nodes The arena, with the root at index 0
+         * @param forEachChild Called with a node and a function, which it calls with the byte and arena
+         *        index of every child of the node in byte order
+         */
+        template <typename ForEachChild>
+        DoubleArrayTrie(const std::vector<Node>& nodes, ForEachChild forEachChild) {
+            std::vector<Unit> unitArray;
+            std::vector<uint32_t> valueArray;
+            std::vector<int32_t> nextFree, prevFree;    /// Doubly linked list of the free slots
+            int32_t freeHead = -1, freeTail = -1;       /// Ends of the free list, or -1 if it is empty
+            int32_t scanHead = -1;                      /// First free slot still tried as a child slot
+            std::vector<uint8_t> failures;              /// Number of times each free slot did not fit
+            uint64_t states = 1;
+
+            /// Appends free slots until the arrays have at least 'size' slots
+            auto grow = [&](size_t size) {
+                size_t old = unitArray.size();
+
+                if (size <= old)
+                    return;
+
+                size = std::max(size, old + old / 2);
+                unitArray.resize(size, { 0, -1 });
+                valueArray.resize(size, 0);
+                nextFree.resize(size);
+                prevFree.resize(size);
+                failures.resize(size, 0);
+
+                for (size_t i = old; i < size; i++) {
+                    prevFree[i] = (int32_t) i - 1;
+                    nextFree[i] = (int32_t) i + 1;
+                }
+
+                prevFree[old] = freeTail;
+                nextFree[size - 1] = -1;
+                (freeTail == -1 ? freeHead : nextFree[freeTail]) = (int32_t) old;
+                freeTail = (int32_t) size - 1;
+
+                if (scanHead == -1)
+                    scanHead = (int32_t) old;
+            };
+
+            /// Removes a slot from the free list
+            auto take = [&](int32_t slot) {
+                int32_t prev = prevFree[slot], next = nextFree[slot];
+                (prev == -1 ? freeHead : nextFree[prev]) = next;
+                (next == -1 ? freeTail : prevFree[next]) = prev;
+
+                if (slot == scanHead)
+                    scanHead = next;
+            };
+
+            grow(1024);
+            take(0);
+            unitArray[0] = { 0, 0 };
+            valueArray[0] = (uint32_t) nodes[0].count;
+
+            /// Place the children of every state, depth first
+            std::vector<std::pair<uint32_t, int32_t>> stack;
+            stack.push_back({ 0, 0 });
+            int codes[CODES];
+            uint32_t children[CODES];
+
+            while (!stack.empty()) {
+                auto [node, state] = stack.back();
+                stack.pop_back();
+                int numCodes = 0;
+
+                forEachChild(node, [&](unsigned char c, uint32_t child) {
+                    codes[numCodes] = c + 1;
+                    children[numCodes++] = child;
+                });
+
+                if (numCodes == 0)
+                    continue;
+
+                /// Try every free slot as the home of the first child until all children fit
+                int32_t base = 0;
+
+                for (int32_t slot = scanHead; ; slot = nextFree[slot]) {
+                    if (slot == -1) {
+                        slot = (int32_t) unitArray.size();
+                        grow(unitArray.size() + CODES + 1);
+                    }
+
+                    base = slot - codes[0];
+                    bool fits = base >= 0;
+
+                    if (fits) {
+                        grow((size_t) base + CODES + 1);
+
+                        for (int i = 1; i < numCodes && fits; i++)
+                            fits = unitArray[base + codes[i]].check == -1;
+
+                        if (fits)
+                            break;
+                    }
+
+                    /// Stop scanning from a slot that keeps failing, which leaves it free for good
+                    if (++failures[slot] >= MAX_FAILURES && slot == scanHead)
+                        scanHead = nextFree[slot];
+                }
+
+                unitArray[state].base = base;
+
+                for (int i = 0; i < numCodes; i++) {
+                    int32_t slot = base + codes[i];
+                    const Node& child = nodes[children[i]];
+
+                    take(slot);
+                    unitArray[slot].check = state;
+                    valueArray[slot] = (uint32_t) child.count | (child.isWordEnding ? WORD_ENDING : 0);
+                    stack.push_back({ children[i], slot });
+                    states++;
+                }
+            }
+
+            /// Trim the free tail, keeping room for a transition out of any state
+            size_t size = 1;
+
+            for (size_t i = 0; i < unitArray.size(); i++) {
+                if (unitArray[i].check != -1)
+                    size = std::max(size, (size_t) unitArray[i].base + CODES + 1);
+            }
+
+            DoubleArrayTrieHeader bufferHeader;
+            bufferHeader.units = size;
+            bufferHeader.states = states;
+
+            storage.assign(bufferHeader.FileSize() / sizeof(uint64_t), 0);
+            char* base = (char*) storage.data();
+            memcpy(base, &bufferHeader, sizeof(DoubleArrayTrieHeader));
+            memcpy(base + sizeof(DoubleArrayTrieHeader), unitArray.data(), size * sizeof(Unit));
+            memcpy(base + sizeof(DoubleArrayTrieHeader) + size * sizeof(Unit), valueArray.data(),
+                size * sizeof(uint32_t));
+
+            Attach(base);
+        }
+
+        /**
+         * @brief The Attach() function points the array pointers into a buffer.
+         * @param base The start of the buffer
+         */
+        void Attach(const void* base) {
+            const char* bytes = (const char*) base;
+
+            header = (const DoubleArrayTrieHeader*) bytes;
+            units = (const Unit*) (bytes + sizeof(DoubleArrayTrieHeader));
+            values = (const uint32_t*) (bytes + sizeof(DoubleArrayTrieHeader) + header->units * sizeof(Unit));
+        }
+
+        /**
+         * @brief The IsValid() function checks that the root is in use, and that every slot in use has a
+         *        parent inside the arrays and room for a transition out of it, so that Find() never reads
+         *        outside the arrays.
+         * @return Returns true if the arrays are consistent
+         */
+        bool IsValid() const {
+            int64_t size = (int64_t) header->units;
+
+            if (units[0].check == -1)
+                return false;
+
+            for (int64_t i = 0; i < size; i++) {
+                if (units[i].check == -1)
+                    continue;
+
+                if (units[i].check < 0 || units[i].check >= size || units[i].base < 0 ||
+                    (int64_t) units[i].base + CODES >= size)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief The Close() function unmaps the file and closes its file descriptor.
+         */
+        void Close() {
+            if (mapping != nullptr)
+                munmap(mapping, mappingSize);
+
+            if (fd != -1)
+                close(fd);
+
+            fd = -1;
+            mapping = nullptr;
+            mappingSize = 0;
+        }
+
+        /**
+         * @brief The Find() function follows a key from the root.
+         * @param key The key to be followed
+         * @return Returns the state the key ends in, or -1 if the key leaves the trie
+         */
+        int32_t Find(std::string_view key) const {
+            if (key.empty())
+                throw "Empty string";
+
+            int32_t state = 0;
+
+            for (char ch : key) {
+                int32_t next = units[state].base + Code(ch);
+
+                if (units[next].check != state)
+                    return -1;
+
+                state = next;
+            }
+
+            return state;
+        }
+
+    public:
+        /**
+         * @brief DoubleArrayTrie constructor from a saved file, which is memory mapped and queried in place
+         * @param path Path of the file
+         */
+        DoubleArrayTrie(const std::string& path) {
+            fd = open(path.c_str(), O_RDONLY);
+
+            if (fd == -1)
+                throw "Unable to open trie file";
+
+            struct stat info;
+
+            if (fstat(fd, &info) == -1 || (size_t) info.st_size < sizeof(DoubleArrayTrieHeader)) {
+                Close();
+                throw "Invalid trie file";
+            }
+
+            mappingSize = (size_t) info.st_size;
+            mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                Close();
+                throw "Unable to map trie file";
+            }
+
+            /// Validate the header before trusting the array sizes
+            const DoubleArrayTrieHeader* fileHeader = (const DoubleArrayTrieHeader*) mapping;
+
+            if (fileHeader->magic != DoubleArrayTrieHeader::MAGIC ||
+                fileHeader->version != DoubleArrayTrieHeader::VERSION ||
+                fileHeader->units <= CODES || fileHeader->units > INT32_MAX ||
+                fileHeader->FileSize() != mappingSize) {
+                Close();
+                throw "Invalid trie file";
+            }
+
+            Attach(mapping);
+
+            if (!IsValid()) {
+                Close();
+                throw "Invalid trie file";
+            }
+        }
+
+        ~DoubleArrayTrie() {
+            Close();
+        }
+
+        DoubleArrayTrie(const DoubleArrayTrie&) = delete;
+        DoubleArrayTrie& operator=(const DoubleArrayTrie&) = delete;
+
+        /**
+         * @brief The Save() function writes the buffer to a file.
+         * @param path Path of the file to be written
+         */
+        void Save(const std::string& path) const {
+            FILE* file = fopen(path.c_str(), "wb");
+
+            if (file == nullptr)
+                throw "Unable to create trie file";
+
+            size_t size = (size_t) header->FileSize();
+            size_t written = fwrite(header, 1, size, file);
+
+            if (fclose(file) != 0 || written != size)
+                throw "Unable to write trie file";
+        }
+
+        /**
+         * @brief The Count() function gets the number of inserted words that start with a prefix (key).
+         * @param key The prefix to check the count of
+         * @return Returns the count of the prefix
+         */
+        int Count(std::string_view key) const {
+            int32_t state = Find(key);
+
+            return state == -1 ? 0 : (int) (values[state] & COUNT_MASK);
+        }
+
+        /**
+         * @brief The Contains() function checks if a string (key) is contained within the trie, with the
+         *        same meaning as Trie::Contains().
+         * @param key The string to be checked
+         * @return Returns true if the string (key) is contained within the trie
+         */
+        bool Contains(std::string_view key) const {
+            return Count(key) != 0;
+        }
+
+        /**
+         * @brief The IsWord() function checks if a string (key) was inserted as a whole word.
+         * @param key The string to be checked
+         * @return Returns true if a word ends at the last character of the key
+         */
+        bool IsWord(std::string_view key) const {
+            int32_t state = Find(key);
+
+            return state != -1 && (values[state] & WORD_ENDING) != 0;
+        }
+
+        /**
+         * @brief The StateCount() function returns the number of states, including the root.
+         * @return Returns the number of states
+         */
+        size_t StateCount() const {
+            return (size_t) header->states;
+        }
+
+        /**
+         * @brief The SlotCount() function returns the number of slots in the arrays, used or free.
+         * @return Returns the number of slots
+         */
+        size_t SlotCount() const {
+            return (size_t) header->units;
+        }
+
+        /**
+         * @brief The MemoryUsage() function returns the size of the buffer.
+         * @return Returns the size of the header and arrays in bytes
+         */
+        size_t MemoryUsage() const {
+            return (size_t) header->FileSize();
+        }
+
+};
@@ -1,66 +1,164 @@
 #pragma once
 
-#include <iostream>
-#include <map>
+#include <cstdint>
+#include <vector>
 
 /**
  * @file Node.h
  * @author Original JAVA by William Fiset (william.alexandre.fiset@gmail.com)
  *         C++ conversion by 0xChristopher
- * @brief The Node struct contains the Node variables and pointers.
+ * @brief The Node struct contains the Node variables and a reference to its children. Nodes live in an
+ *        arena owned by the Trie and refer to each other by 32-bit index into it.
+ *
+ *        Keys may hold any byte, so the children are stored the way an Adaptive Radix Tree stores them: in
+ *        a block whose layout depends on how many children there are, and which is replaced by the next
+ *        larger or smaller layout as children are added or removed. Every layout lives in its own pool.
+ *
+ *              Layout          Children        Bytes       Search
+ *              Node1           1               0           the child's own character
+ *              Node4           2 to 4          20          scan of the sorted keys
+ *              Node16          5 to 16         80          scan of the sorted keys
+ *              Node48          17 to 48        448         byte-indexed slot, then the child
+ *              Node256         49 to 256       1024        byte-indexed child
+ *
+ *        A node without children refers to no block at all, and a node with a single child refers to the
+ *        child directly. Leaves and single-child chains, which make up most of a Trie, therefore cost only
+ *        the nodes themselves, and following a single child reads no memory besides the child.
  */
 
 class Node {
     friend class Trie;
+    friend class DoubleArrayTrie;
+    friend class AhoCorasick;
+
+    public:
+        static const uint32_t NONE = 0;         /// Index of a missing child (the root is never a child)
+
+        /// Layout of the block that holds the children of a node
+        enum Type : uint8_t {
+            NODE0,
+            NODE1,
+            NODE4,
+            NODE16,
+            NODE48,
+            NODE256
+        };
 
     private:
-        char m_ch;                              /// The char value of a node
         int count = 0;                          /// The number of strings/insertions a node belongs to
+        int ends = 0;                           /// The number of insertions that end at a node
+        int best = 0;                           /// The highest 'ends' in a node's subtree, itself included
+        uint32_t block = 0;                     /// Index of the children block in the pool of its type, or of
+                                                /// the only child of a Node1
+        uint16_t numChildren = 0;               /// Number of children
+        Type type = NODE0;                      /// Layout of the children block
+        char m_ch;                              /// The char value of a node
         bool isWordEnding = false;              /// Is true if node represents the end of a word
-        std::map<char, Node*> children;         /// Mapping of node children
 
     public:
         /**
          * @brief Node constructor and destructor
          * @param ch Character value
          */
-        Node(char& ch) 
-            : m_ch(ch) {
-            for (char i = 'a'; i <= 'z'; i++)
-                this->children.emplace(i, nullptr);
+        Node(char ch)
+            : m_ch(ch) {}
 
-            std::cout << "(Node created)" << std::endl;
-        }
+        ~Node() {}
 
-        /// Root node constructor
-        Node(const char& ch) 
-            : m_ch(ch) {
-            for (char i = 'a'; i <= 'z'; i++)
-                this->children.emplace(i, nullptr);
+};
 
-            std::cout << "(Node created)" << std::endl;
-        }
+/**
+ * @brief The Node4 struct holds up to 4 children, sorted by key byte.
+ */
+struct Node4 {
+    static const int CAPACITY = 4;
 
-        ~Node() {
-            std::cout << "(Node removed)" << std::endl;
-        }
+    uint8_t keys[CAPACITY];                     /// Key byte of every child
+    uint32_t children[CAPACITY];                /// Arena index of every child
+};
 
-        /**
-         * @brief The AddChild() function adds a child node to the current node's map
-         * @param node The node to be added to the local map
-         * @param c The char key of the local map
-         */
-        void AddChild(Node*& node, char c) {
-            children.at(c) = node;
-        }
+/**
+ * @brief The Node16 struct holds up to 16 children, sorted by key byte.
+ */
+struct Node16 {
+    static const int CAPACITY = 16;
 
-        /**
-         * @brief The RemoveChild() function removes a child node from the current nodes map and resets it.
-         * @param c The key of the node to be removed
-         */
-        void RemoveChild(char c) {
-            children.erase(c);
-            children.emplace(c, nullptr);
+    uint8_t keys[CAPACITY];                     /// Key byte of every child
+    uint32_t children[CAPACITY];                /// Arena index of every child
+};
+
+/**
+ * @brief The Node48 struct holds up to 48 children in any order, found through a table of all bytes.
+ */
+struct Node48 {
+    static const int CAPACITY = 48;
+
+    uint8_t index[256];                         /// One past the slot of the child of every byte, or 0
+    uint32_t children[CAPACITY];                /// Arena index of every child, the first numChildren used
+};
+
+/**
+ * @brief The Node256 struct holds a child for every byte.
+ */
+struct Node256 {
+    static const int CAPACITY = 256;
+
+    uint32_t children[CAPACITY];                /// Arena index of the child of every byte, or NONE
+};
+
+/**
+ * @brief The BlockPool struct stores the children blocks of one layout, and reuses freed blocks first.
+ */
+template <typename Block>
+struct BlockPool {
+    std::vector<Block> blocks;                  /// All blocks of the layout
+    std::vector<uint32_t> freeBlocks;           /// Indices of freed blocks
+
+    /**
+     * @brief The New() function takes a zeroed block from the free list, or else from the end of the pool.
+     * @return Returns the index of the block
+     */
+    uint32_t New() {
+        if (!freeBlocks.empty()) {
+            uint32_t index = freeBlocks.back();
+            freeBlocks.pop_back();
+            blocks[index] = Block();
+
+            return index;
         }
 
-};
\ No newline at end of file
+        blocks.emplace_back();
+
+        return (uint32_t) (blocks.size() - 1);
+    }
+
+    /**
+     * @brief The Free() function returns a block to the pool.
+     * @param index The index of the block
+     */
+    void Free(uint32_t index) {
+        freeBlocks.push_back(index);
+    }
+
+    /**
+     * @brief The Clear() function frees all blocks, keeping the capacity of the pool.
+     */
+    void Clear() {
+        blocks.clear();
+        freeBlocks.clear();
+    }
+
+    /**
+     * @return Returns the number of blocks in use
+     */
+    size_t Used() const {
+        return blocks.size() - freeBlocks.size();
+    }
+
+    /**
+     * @return Returns the bytes allocated by the pool
+     */
+    size_t MemoryUsage() const {
+        return blocks.capacity() * sizeof(Block) + freeBlocks.capacity() * sizeof(uint32_t);
+    }
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @file RadixNode.h
+ * @author 0xChristopher
+ * @brief The RadixNode struct is a node of the RadixTrie. It stands for a whole chain of Trie nodes, and the
+ *        characters of the chain form the label of the edge from its parent, stored as a span into the
+ *        string pool of the RadixTrie. Children are kept in a singly linked sibling list, with the first
+ *        character of every label copied into the node so a sibling scan never reads the pool.
+ */
+
+struct RadixNode {
+    static const uint32_t NONE = 0;             /// Index of a missing node (the root is never a child)
+
+    uint32_t labelStart = 0;                    /// Position of the edge label in the string pool
+    uint32_t labelLength = 0;                   /// Length of the edge label
+    uint32_t firstChild = NONE;                 /// Arena index of the first child
+    uint32_t nextSibling = NONE;                /// Arena index of the next child of the same parent
+    int count = 0;                              /// The number of strings/insertions a node belongs to
+    char first = 0;                             /// First character of the edge label
+    bool isWordEnding = false;                  /// Is true if the label ends a word
+};
@@ -0,0 +1,146 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include "Trie.h"
+#include "RadixTrie.h"
+
+/**
+ * @file RadixTrie.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the RadixTrie data structure, and a comparison with Trie on keys that
+ *        share long prefixes
+ */
+
+std::string keys[] = {"romane", "romanus", "romulus", "rubens", "ruber", "rubicon", "rubicundus"};
+std::string testKey = "rom";                                        /// Prefix to count
+std::string removeKey = "rubicon";                                  /// String to remove from RadixTrie
+static int benchmarkKeys = 500000;                                  /// Keys in the benchmark
+
+/**
+ * @brief The MakeWord() function builds a pronounceable word of 2 or 3 syllables.
+ * @param rng The random number generator
+ * @return Returns the word
+ */
+std::string MakeWord(std::mt19937& rng) {
+    static const char* consonants = "bcdfghjklmnprstvwz";
+    static const char* vowels = "aeiou";
+    std::string word;
+    int syllables = 2 + rng() % 2;
+
+    for (int i = 0; i < syllables; i++) {
+        word += consonants[rng() % 18];
+        word += vowels[rng() % 5];
+    }
+
+    return word;
+}
+
+/**
+ * @brief The MakeKeys() function builds keys shaped like URLs without punctuation: a host, a few path
+ *        segments from a small vocabulary, and a unique document name at the end.
+ * @param count The number of keys
+ * @return Returns the keys
+ */
+std::vector<std::string> MakeKeys(int count) {
+    std::mt19937 rng(42);
+    std::vector<std::string> hosts, segments, keys(count);
+
+    for (int i = 0; i < 20; i++)
+        hosts.push_back("httpswww" + MakeWord(rng) + MakeWord(rng) + "com");
+
+    for (int i = 0; i < 200; i++)
+        segments.push_back(MakeWord(rng));
+
+    for (auto& key : keys) {
+        key = hosts[rng() % hosts.size()];
+
+        for (int depth = 1 + rng() % 3; depth > 0; depth--)
+            key += segments[rng() % segments.size()];
+
+        key += MakeWord(rng) + MakeWord(rng);
+    }
+
+    return keys;
+}
+
+/**
+ * @brief The Seconds() function measures how long a function runs.
+ * @param function The function to be timed
+ * @return Returns the time in seconds
+ */
+template <typename Function>
+double Seconds(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main() {
+    RadixTrie radixTrie;
+
+    /// @brief Insert key array into RadixTrie
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Inserting keys..." << std::endl;
+
+    for (auto& key : keys)
+        radixTrie.Insert(key);
+
+    std::cout << radixTrie.NodeCount() << " nodes for " << std::size(keys) << " keys" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Count a prefix and remove a key
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "\"" << testKey << "\" starts " << radixTrie.Count(testKey) << " keys" << std::endl;
+    std::cout << "Removing \"" << removeKey << "\"..." << std::endl;
+    radixTrie.Remove(removeKey);
+
+    if (radixTrie.Contains(removeKey))
+        std::cout << "The RadixTrie contains \"" << removeKey << "\"" << std::endl;
+    else
+        std::cout << "The RadixTrie doesn't contain \"" << removeKey << "\"" << std::endl;
+
+    std::cout << radixTrie.NodeCount() << " nodes left" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+    radixTrie.Clear();
+
+    /// @brief Compare with Trie on keys that share long prefixes
+    std::vector<std::string> urls = MakeKeys(benchmarkKeys);
+    size_t characters = 0;
+    Trie trie;
+    int found = 0;
+
+    for (auto& url : urls)
+        characters += url.size();
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    printf("Benchmarking %d keys of %.1f characters on average...\n", benchmarkKeys,
+        (double) characters / benchmarkKeys);
+
+    double trieInsert = Seconds([&]() { for (auto& url : urls) trie.Insert(url); });
+    double trieLookup = Seconds([&]() { for (auto& url : urls) found += trie.Contains(url); });
+    TrieStats trieStats = trie.Stats();
+
+    printf("Trie:      insert %.2f M keys/s, lookup %.2f M keys/s, %.1f bytes per key, %.1f nodes visited per lookup\n",
+        benchmarkKeys / trieInsert / 1e6, benchmarkKeys / trieLookup / 1e6,
+        (double) trieStats.bytesUsed / benchmarkKeys, (double) characters / benchmarkKeys);
+
+    double radixInsert = Seconds([&]() { for (auto& url : urls) radixTrie.Insert(url); });
+    radixTrie.ResetNodeVisits();
+    double radixLookup = Seconds([&]() { for (auto& url : urls) found += radixTrie.Contains(url); });
+    RadixTrieStats radixStats = radixTrie.Stats();
+
+    printf("RadixTrie: insert %.2f M keys/s, lookup %.2f M keys/s, %.1f bytes per key, %.1f nodes visited per lookup\n",
+        benchmarkKeys / radixInsert / 1e6, benchmarkKeys / radixLookup / 1e6,
+        (double) radixStats.bytesUsed / benchmarkKeys, (double) radixTrie.NodeVisits() / benchmarkKeys);
+    printf("%zu Trie nodes, %zu RadixTrie nodes and %zu label bytes (%d found)\n", trieStats.nodes,
+        radixStats.nodes, radixStats.poolBytes, found);
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
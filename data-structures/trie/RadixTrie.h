@@ -0,0 +1,446 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "../trie/RadixNode.h"
+
+/**
+ * @file RadixTrie.h
+ * @author 0xChristopher
+ * @brief Radix (Patricia) trie implementation, a path-compressed Trie with the same Insert(), Remove(),
+ *        Contains() and Count() semantics. Every chain of Trie nodes that has a single child and ends no
+ *        word is merged into one node, and the characters of the chain become the label of the edge into
+ *        it. Keys that share long prefixes and diverge near the end, such as URLs and file paths, need a
+ *        node per branch instead of a node per character.
+ *
+ *        Edge labels are spans into one shared string pool. Inserting a key appends only the part of it
+ *        that no node covers yet, and splitting an edge just divides its span. Labels of removed nodes stay
+ *        in the pool as garbage until Clear(), which is reported by Stats(). Nodes live in an arena linked
+ *        by 32-bit index and removed nodes are reused, as in Trie.
+ *
+ *        Every node keeps the same count its chain would have in a Trie. Insert() and Remove() split an
+ *        edge where a key ends inside of it, so that the count can change from that point on, and Remove()
+ *        merges a node back into its only child once their counts agree again.
+ *
+ *        Time Complexity:
+ *              Operation       Average     Best
+ *              Insertion       O(n)        O(n)
+ *              Deletion        O(n)        O(n)
+ *              Search          O(n)        O(1)
+ *              Clear           O(1)        O(1)
+ */
+
+/**
+ * @brief The RadixTrieStats struct reports the node count and memory use of a RadixTrie.
+ */
+struct RadixTrieStats {
+    size_t nodes;                                   /// Nodes in use below the root
+    size_t freeNodes;                               /// Removed nodes waiting in the free list
+    size_t poolBytes;                               /// Bytes of edge labels in the string pool
+    size_t poolGarbage;                             /// Pool bytes of removed or merged labels
+    size_t bytesUsed;                               /// Bytes of the nodes in use and the live labels
+    size_t bytesReserved;                           /// Bytes allocated by the arena, pool and free list
+};
+
+class RadixTrie {
+
+    private:
+        static constexpr uint32_t ROOT = 0;         /// Arena index of the root
+        std::vector<RadixNode> nodes;               /// Arena of all nodes, the root first
+        std::vector<uint32_t> freeNodes;            /// Arena indices of removed nodes, reused first
+        std::string pool;                           /// Edge labels of all nodes
+        size_t poolGarbage = 0;                     /// Pool bytes no node refers to anymore
+        size_t nodeVisits = 0;                      /// Nodes read while looking for children
+
+        /**
+         * @brief The NewNode() function takes a node from the free list, or else from the end of the arena.
+         * @return Returns the arena index of the node
+         */
+        uint32_t NewNode() {
+            if (!freeNodes.empty()) {
+                uint32_t index = freeNodes.back();
+                freeNodes.pop_back();
+                nodes[index] = RadixNode();
+
+                return index;
+            }
+
+            if (nodes.size() > UINT32_MAX)
+                throw "Trie arena full";
+
+            nodes.emplace_back();
+
+            return (uint32_t) (nodes.size() - 1);
+        }
+
+        /**
+         * @brief The FreeSubtree() function moves a node and all nodes below it to the free list.
+         * @param index The arena index of the subtree root, which must already be unlinked
+         */
+        void FreeSubtree(uint32_t index) {
+            size_t first = freeNodes.size();
+            freeNodes.push_back(index);
+
+            /// The free list doubles as the work list of the traversal
+            for (size_t i = first; i < freeNodes.size(); i++) {
+                RadixNode& node = nodes[freeNodes[i]];
+                poolGarbage += node.labelLength;
+
+                for (uint32_t child = node.firstChild; child != RadixNode::NONE; child = nodes[child].nextSibling)
+                    freeNodes.push_back(child);
+            }
+        }
+
+        /**
+         * @brief The FindChild() function finds the child whose label starts with a character.
+         * @param parent The arena index of the parent
+         * @param ch The first character of the label
+         * @return Returns the arena index of the child, or NONE if there is none
+         */
+        uint32_t FindChild(uint32_t parent, char ch) {
+            for (uint32_t child = nodes[parent].firstChild; child != RadixNode::NONE;
+                child = nodes[child].nextSibling) {
+                nodeVisits++;
+
+                if (nodes[child].first == ch)
+                    return child;
+            }
+
+            return RadixNode::NONE;
+        }
+
+        /**
+         * @brief The Unlink() function removes a child from the sibling list of its parent.
+         * @param parent The arena index of the parent
+         * @param child The arena index of the child
+         */
+        void Unlink(uint32_t parent, uint32_t child) {
+            uint32_t* link = &nodes[parent].firstChild;
+
+            while (*link != child)
+                link = &nodes[*link].nextSibling;
+
+            *link = nodes[child].nextSibling;
+            nodes[child].nextSibling = RadixNode::NONE;
+        }
+
+        /**
+         * @brief The Split() function divides the edge into a node, so that a new node ends after the first
+         *        'length' characters of the label and the rest of the label leads on to the old node.
+         * @param parent The arena index of the parent
+         * @param child The arena index of the node whose edge is split
+         * @param length Length of the first part of the label, which must be less than the label length
+         * @return Returns the arena index of the new node in between
+         */
+        uint32_t Split(uint32_t parent, uint32_t child, uint32_t length) {
+            uint32_t middle = NewNode();
+            RadixNode& upper = nodes[middle];
+            RadixNode& lower = nodes[child];
+
+            upper.labelStart = lower.labelStart;
+            upper.labelLength = length;
+            upper.first = lower.first;
+            upper.count = lower.count;
+            upper.firstChild = child;
+
+            lower.labelStart += length;
+            lower.labelLength -= length;
+            lower.first = pool[lower.labelStart];
+
+            /// Take the place of the old node among its siblings
+            uint32_t* link = &nodes[parent].firstChild;
+
+            while (*link != child)
+                link = &nodes[*link].nextSibling;
+
+            *link = middle;
+            upper.nextSibling = lower.nextSibling;
+            lower.nextSibling = RadixNode::NONE;
+
+            return middle;
+        }
+
+        /**
+         * @brief The Merge() function merges a node with its only child, if no word ends at the node and
+         *        both have the same count, so the two edges would form a single chain in a Trie.
+         * @param index The arena index of the node
+         */
+        void Merge(uint32_t index) {
+            RadixNode& node = nodes[index];
+            uint32_t child = node.firstChild;
+
+            if (index == ROOT || node.isWordEnding || child == RadixNode::NONE ||
+                nodes[child].nextSibling != RadixNode::NONE || nodes[child].count != node.count)
+                return;
+
+            RadixNode& lower = nodes[child];
+
+            /// Labels that were split apart are still next to each other in the pool
+            if (node.labelStart + node.labelLength != lower.labelStart) {
+                std::string label = pool.substr(node.labelStart, node.labelLength) +
+                    pool.substr(lower.labelStart, lower.labelLength);
+
+                poolGarbage += label.size();
+                node.labelStart = Append(label);
+            }
+
+            node.labelLength += lower.labelLength;
+            node.isWordEnding = lower.isWordEnding;
+            node.firstChild = lower.firstChild;
+            freeNodes.push_back(child);
+        }
+
+        /**
+         * @brief The Append() function adds a label to the string pool.
+         * @param label The label to be added
+         * @return Returns the position of the label in the pool
+         */
+        uint32_t Append(std::string_view label) {
+            if (pool.size() + label.size() > UINT32_MAX)
+                throw "String pool full";
+
+            uint32_t start = (uint32_t) pool.size();
+            pool.append(label);
+
+            return start;
+        }
+
+        /**
+         * @brief The Match() function counts the characters a key and the label of a node share.
+         * @param node The arena index of the node
+         * @param key The key
+         * @param i The position in the key where the label starts
+         * @return Returns the length of the common prefix of the label and the rest of the key
+         */
+        uint32_t Match(uint32_t node, std::string_view key, size_t i) {
+            const char* label = pool.data() + nodes[node].labelStart;
+            size_t length = std::min<size_t>(nodes[node].labelLength, key.size() - i);
+            size_t j = 1;
+
+            /// The first character already matched when the child was found
+            while (j < length && label[j] == key[i + j])
+                j++;
+
+            return (uint32_t) j;
+        }
+
+        /**
+         * @brief The Insert() function attempts to insert a string of characters into the RadixTrie.
+         * @param key The string to be inserted
+         * @param numInserts Number of insertions
+         * @return Returns true upon successful insertion
+         */
+        bool Insert(std::string_view key, int numInserts) {
+            if (key.empty())
+                throw "Empty string";
+            else if (numInserts <= 0)
+                throw "numInserts must be greater than zero";
+
+            uint32_t node = ROOT;
+            bool isPrefix = false;
+
+            for (size_t i = 0; i < key.size(); ) {
+                uint32_t child = FindChild(node, key[i]);
+
+                /// The rest of the key becomes a new leaf
+                if (child == RadixNode::NONE) {
+                    uint32_t leaf = NewNode();
+                    RadixNode& added = nodes[leaf];
+
+                    added.labelStart = Append(key.substr(i));
+                    added.labelLength = (uint32_t) (key.size() - i);
+                    added.first = key[i];
+                    added.count = numInserts;
+                    added.isWordEnding = true;
+                    added.nextSibling = nodes[node].firstChild;
+                    nodes[node].firstChild = leaf;
+
+                    return isPrefix;
+                }
+
+                uint32_t match = Match(child, key, i);
+
+                /// The key ends or diverges inside the label
+                if (match < nodes[child].labelLength)
+                    child = Split(node, child, match);
+                else if (nodes[child].isWordEnding)
+                    isPrefix = true;
+
+                node = child;
+                nodes[node].count += numInserts;
+                i += match;
+            }
+
+            nodes[node].isWordEnding = true;
+
+            return true;
+        }
+
+        /**
+         * @brief The Remove() function attempts to remove a string from the RadixTrie.
+         * @param key The string to be removed
+         * @param numDeletions Number of deletions
+         * @return Returns true upon successful removal
+         */
+        bool Remove(std::string_view key, int numDeletions) {
+            if (!Contains(key))
+                return false;
+
+            uint32_t node = ROOT;
+
+            for (size_t i = 0; i < key.size(); ) {
+                uint32_t child = FindChild(node, key[i]);
+                uint32_t match = Match(child, key, i);
+
+                /// The key ends inside the label, so the count changes from there on
+                if (match < nodes[child].labelLength)
+                    child = Split(node, child, match);
+
+                nodes[child].count -= numDeletions;
+
+                /// Cut this edge if the current node has a count <= 0
+                /// This means that all the prefixes below this point are inaccessible
+                if (nodes[child].count <= 0) {
+                    Unlink(node, child);
+                    FreeSubtree(child);
+                    Merge(node);
+
+                    return true;
+                }
+
+                node = child;
+                i += match;
+            }
+
+            return true;
+        }
+
+    public:
+        /**
+         * @brief RadixTrie constructor and destructor
+         */
+        RadixTrie() {
+            nodes.emplace_back();
+        }
+
+        ~RadixTrie() {}
+
+        /**
+         * @brief The public facing Insert() function
+         * @param key The key to be inserted
+         * @return Returns true upon successful insertion
+         */
+        bool Insert(std::string_view key) {
+            return Insert(key, 1);
+        }
+
+        /**
+         * @brief The public facing Remove() function
+         * @param key The string to be removed
+         * @return Returns true upon successful removal
+         */
+        bool Remove(std::string_view key) {
+            return Remove(key, 1);
+        }
+
+        /**
+         * @brief The Count() function gets the count value of a node based on the prefix (key)
+         * @param key The string to check the count of
+         * @return Returns the count of the prefix
+         */
+        int Count(std::string_view key) {
+            if (key.empty())
+                throw "Empty string";
+
+            uint32_t node = ROOT;
+
+            for (size_t i = 0; i < key.size(); ) {
+                node = FindChild(node, key[i]);
+
+                if (node == RadixNode::NONE)
+                    return 0;
+
+                uint32_t match = Match(node, key, i);
+
+                /// A key that ends inside the label still matches, but one that diverges does not
+                if (match < nodes[node].labelLength && i + match < key.size())
+                    return 0;
+
+                i += match;
+            }
+
+            return nodes[node].count;
+        }
+
+        /**
+         * @brief The Contains() function checks if a string (key) is contained within the RadixTrie.
+         * @param key The string to be checked
+         * @return Returns true if the string (key) is contained within the RadixTrie
+         */
+        bool Contains(std::string_view key) {
+            return Count(key) != 0;
+        }
+
+        /**
+         * @brief The Clear() function removes all nodes and labels by resetting the arena and the pool.
+         */
+        void Clear() {
+            nodes.erase(nodes.begin() + 1, nodes.end());
+            nodes[ROOT] = RadixNode();
+            freeNodes.clear();
+            pool.clear();
+            poolGarbage = 0;
+        }
+
+        /**
+         * @brief The NodeCount() function returns the number of nodes below the root.
+         * @return Returns the number of nodes
+         */
+        size_t NodeCount() {
+            return nodes.size() - 1 - freeNodes.size();
+        }
+
+        /**
+         * @brief The NodeVisits() function returns the number of nodes read while looking for children,
+         *        which is the number of likely cache misses of all operations so far.
+         * @return Returns the number of node visits
+         */
+        size_t NodeVisits() {
+            return nodeVisits;
+        }
+
+        /**
+         * @brief The ResetNodeVisits() function sets the node visit counter back to zero.
+         */
+        void ResetNodeVisits() {
+            nodeVisits = 0;
+        }
+
+        /**
+         * @brief The MemoryUsage() function returns the bytes allocated for the nodes and labels.
+         * @return Returns the memory footprint of the arena, pool and free list in bytes
+         */
+        size_t MemoryUsage() {
+            return nodes.capacity() * sizeof(RadixNode) + pool.capacity() +
+                freeNodes.capacity() * sizeof(uint32_t);
+        }
+
+        /**
+         * @brief The Stats() function reports the node count and memory use of the RadixTrie.
+         * @return Returns the statistics
+         */
+        RadixTrieStats Stats() {
+            RadixTrieStats stats;
+            stats.nodes = NodeCount();
+            stats.freeNodes = freeNodes.size();
+            stats.poolBytes = pool.size();
+            stats.poolGarbage = poolGarbage;
+            stats.bytesUsed = (stats.nodes + 1) * sizeof(RadixNode) + pool.size() - poolGarbage;
+            stats.bytesReserved = MemoryUsage();
+
+            return stats;
+        }
+
+};
@@ -1,17 +1,48 @@
 #include <iostream>
 #include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
 #include "Trie.h"
 
 /**
  * @file Trie.cpp
  * @author Original JAVA by William Fiset (william.alexandre.fiset@gmail.com)
  *         C++ conversion by 0xChristopher
- * @brief Functional demonstration of the Trie data structure
+ * @brief Functional demonstration and insert/lookup benchmark of the Trie data structure and its frozen
+ *        double-array form
  */
 
 std::string keys[] = {"this", "that", "thankful", "solo"};          /// Strings to be added to the Trie
 std::string testKey = "cat";                                        /// Key to check if contained within the Trie
 std::string removeKey = "that";                                     /// String to remove from Trie
+std::string completionPrefix = "th";                                /// Prefix to auto-complete
+std::string byteKeys[] = {"C++17", "Zürich", "hello, world!"};       /// Keys outside of 'a' to 'z'
+static int benchmarkWords = 1000000;                                /// Words in the benchmark dictionary
+
+/**
+ * @brief The MakeWord() function builds a pronounceable word out of 2 to 4 syllables, so that words share
+ *        prefixes the way dictionary words do.
+ * @param rng The random number generator
+ * @return Returns the word
+ */
+std::string MakeWord(std::mt19937& rng) {
+    static const char* consonants = "bcdfghjklmnprstvwz";
+    static const char* vowels = "aeiou";
+    std::string word;
+    int syllables = 2 + rng() % 3;
+
+    for (int i = 0; i < syllables; i++) {
+        word += consonants[rng() % 18];
+        word += vowels[rng() % 5];
+
+        if (rng() % 3 == 0)
+            word += consonants[rng() % 18];
+    }
+
+    return word;
+}
 
 int main() {
     Trie trie;
@@ -57,9 +88,118 @@ int main() {
         std::cout << "The Trie doesn't contain \"" << removeKey << "\"" << std::endl;
     std::cout << "------------------------------------------------------" << std::endl;
 
+    /// @brief Keys may hold any byte, including UTF-8
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    for (auto& key : byteKeys)
+        trie.Insert(key);
+
+    for (auto& key : byteKeys) {
+        if (trie.Contains(key))
+            std::cout << "The Trie contains \"" << key << "\"" << std::endl;
+        else
+            std::cout << "The Trie doesn't contain \"" << key << "\"" << std::endl;
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Auto-complete a prefix
+    std::cout << "------------------------------------------------------" << std::endl;
+    trie.Insert(keys[0]);
+    trie.Insert(keys[0]);
+    trie.Insert(keys[2]);
+    std::cout << "Top completions of \"" << completionPrefix << "\":" << std::endl;
+
+    trie.CompletionsOf(completionPrefix, 3, [](std::string_view completion, int count) {
+        std::cout << "  " << completion << " (" << count << ")" << std::endl;
+    });
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
     /// @brief Clear trie
     std::cout << "------------------------------------------------------" << std::endl;
     trie.Clear();
+    std::cout << "Cleared, " << trie.NodeCount() << " nodes left" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Benchmark inserts and lookups on a generated dictionary
+    std::mt19937 rng(42);
+    std::vector<std::string> words(benchmarkWords);
+
+    for (auto& word : words)
+        word = MakeWord(rng);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Benchmarking " << benchmarkWords << " words..." << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto& word : words)
+        trie.Insert(word);
+
+    auto middle = std::chrono::steady_clock::now();
+    int found = 0;
+
+    for (auto& word : words)
+        found += trie.Contains(word);
+
+    auto end = std::chrono::steady_clock::now();
+    double insertTime = std::chrono::duration<double>(middle - start).count();
+    double lookupTime = std::chrono::duration<double>(end - middle).count();
+
+    printf("Insert: %.2f M keys/s\n", benchmarkWords / insertTime / 1e6);
+    printf("Lookup: %.2f M keys/s (%d found)\n", benchmarkWords / lookupTime / 1e6, found);
+    /// Top 10 completions of every two letter prefix
+    int prefixes = 0, completions = 0;
+    start = std::chrono::steady_clock::now();
+
+    for (char a = 'a'; a <= 'z'; a++) {
+        for (char b = 'a'; b <= 'z'; b++, prefixes++) {
+            char prefix[] = { a, b };
+            completions += trie.CompletionsOf(std::string_view(prefix, 2), 10, [](std::string_view, int) {});
+        }
+    }
+
+    end = std::chrono::steady_clock::now();
+    printf("Top 10 completions: %.1f us per prefix (%d found)\n",
+        std::chrono::duration<double, std::micro>(end - start).count() / prefixes, completions);
+
+    TrieStats stats = trie.Stats();
+    printf("Nodes: %zu, %.1f bytes per key in use, %.1f reserved\n", stats.nodes,
+        (double) stats.bytesUsed / benchmarkWords, (double) stats.bytesReserved / benchmarkWords);
+    printf("Children blocks: %zu Node4, %zu Node16, %zu Node48, %zu Node256\n", stats.node4, stats.node16,
+        stats.node48, stats.node256);
+
+    /// Freeze into a double-array trie and repeat the lookups
+    start = std::chrono::steady_clock::now();
+    DoubleArrayTrie frozen = trie.Freeze();
+    middle = std::chrono::steady_clock::now();
+    found = 0;
+
+    for (auto& word : words)
+        found += frozen.Contains(word);
+
+    end = std::chrono::steady_clock::now();
+    double freezeTime = std::chrono::duration<double>(middle - start).count();
+    lookupTime = std::chrono::duration<double>(end - middle).count();
+
+    printf("Freeze: %.2f s, %zu states in %zu slots, %.1f bytes per key\n", freezeTime, frozen.StateCount(),
+        frozen.SlotCount(), (double) frozen.MemoryUsage() / benchmarkWords);
+    printf("Frozen lookup: %.2f M keys/s (%d found)\n", benchmarkWords / lookupTime / 1e6, found);
+
+    /// Remove every other word, which sends the unshared nodes to the free list
+    for (int i = 0; i < benchmarkWords; i += 2)
+        trie.Remove(words[i]);
+
+    stats = trie.Stats();
+    printf("After removing half: %zu nodes (%zu free), %zu of %zu bytes in use\n", stats.nodes,
+        stats.freeNodes, stats.bytesUsed, stats.bytesReserved);
+
+    start = std::chrono::steady_clock::now();
+    trie.Clear();
+    end = std::chrono::steady_clock::now();
+
+    printf("Clear: %.3f ms\n", std::chrono::duration<double, std::milli>(end - start).count());
     std::cout << "------------------------------------------------------" << std::endl;
 
     std::cin.get();
@@ -1,29 +1,407 @@
+#pragma once
+
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <functional>
+#include <queue>
+#include <algorithm>
 #include "../trie/Node.h"
+#include "../trie/DoubleArrayTrie.h"
 
 /**
  * @file Trie.h
  * @author Original JAVA by William Fiset (william.alexandre.fiset@gmail.com)
  *         C++ conversion by 0xChristopher
  * @brief Trie data structure implementation. This data structure provides a way to look up values of nodes
- *        which are stored in maps in parent nodes. For this reason, the root of the Trie is set to an
+ *        which are stored in blocks referenced by parent nodes. For this reason, the root of the Trie is set to an
  *        arbitrary value. Each node is marked with a boolean that determines whether or not the node value
  *        marks the end of a word, as well as how many words the current node belongs to. This allows the
  *        data structure to know when to remove certain nodes. The Trie is great for applications such as 
  *        auto-complete functionality.
+ *
+ *        All nodes are allocated from one contiguous arena and linked by 32-bit index, with the root at
+ *        index 0. Nodes cut off by Remove() go to a free list and are reused by later insertions, and
+ *        Clear() simply resets the arena instead of freeing the nodes one by one. Once no more keys will
+ *        be inserted, Freeze() compiles the Trie into a read-optimized DoubleArrayTrie.
+ *
+ *        Keys are arbitrary byte strings, including digits, punctuation and UTF-8. Each node keeps its
+ *        children in a block of the smallest of four layouts that fits them (see Node.h), so a node pays
+ *        for the children it has rather than for the size of the alphabet.
+ *
+ *        For auto-complete, every node also counts the insertions that end at it, and caches the highest
+ *        such count in its subtree. CompletionsOf() uses the cached counts as bounds in a best-first search,
+ *        so finding the top k completions only visits the branches that lead to them.
  * 
  *        Time Complexity: 
  *              Operation       Average     Best
  *              Insertion       O(n)        O(n)
  *              Deletion        O(n)        O(n)
  *              Search          O(n)        O(1)
+ *              Clear           O(1)        O(1)
+ *              Completions     O(m + k*l*log(k*l))     for the top k completions of length l of an m long prefix
+ */
+
+/**
+ * @brief The TrieStats struct reports the node count and memory use of a Trie.
  */
+struct TrieStats {
+    size_t nodes;                                   /// Nodes in use below the root
+    size_t freeNodes;                               /// Removed nodes waiting in the free list
+    size_t arenaCapacity;                           /// Nodes the arena holds before it grows
+    size_t node4;                                   /// Children blocks of each layout in use
+    size_t node16;
+    size_t node48;
+    size_t node256;
+    size_t bytesUsed;                               /// Bytes of the nodes and blocks in use, including the root
+    size_t bytesReserved;                           /// Bytes allocated by the arena, the pools and the free list
+};
 
 class Trie {
+    friend class AhoCorasick;
+
+    public:
+        /// Receives every completion, as a view that is only valid during the call, and its count
+        using CompletionCallback = std::function<void(std::string_view completion, int count)>;
 
     private:
+        static constexpr uint32_t ROOT = 0;             /// Arena index of the root
         const char rootCharacter = '.';             /// Root value (arbitrary)
-        Node* root = new Node(rootCharacter);       /// Root node of Trie
+        std::vector<Node> nodes;                    /// Arena of all nodes, the root first
+        std::vector<uint32_t> freeNodes;            /// Arena indices of removed nodes, reused first
+        std::vector<uint32_t> path;                 /// Nodes along the last key, reused between calls
+        BlockPool<Node4> node4;                     /// Children blocks of each layout
+        BlockPool<Node16> node16;
+        BlockPool<Node48> node48;
+        BlockPool<Node256> node256;
+
+        /**
+         * @brief The Child() function finds the child of a node for a byte.
+         * @param node The node
+         * @param c The byte of the child
+         * @return Returns the arena index of the child, or NONE if there is none
+         */
+        uint32_t Child(const Node& node, unsigned char c) {
+            switch (node.type) {
+                case Node::NODE1:
+                    return nodes[node.block].m_ch == (char) c ? node.block : Node::NONE;
+                case Node::NODE4: {
+                    const Node4& block = node4.blocks[node.block];
+
+                    for (int i = 0; i < node.numChildren; i++) {
+                        if (block.keys[i] == c)
+                            return block.children[i];
+                    }
+
+                    return Node::NONE;
+                }
+                case Node::NODE16: {
+                    const Node16& block = node16.blocks[node.block];
+
+                    for (int i = 0; i < node.numChildren; i++) {
+                        if (block.keys[i] == c)
+                            return block.children[i];
+                    }
+
+                    return Node::NONE;
+                }
+                case Node::NODE48: {
+                    const Node48& block = node48.blocks[node.block];
+
+                    return block.index[c] == 0 ? Node::NONE : block.children[block.index[c] - 1];
+                }
+                case Node::NODE256:
+                    return node256.blocks[node.block].children[c];
+                default:
+                    return Node::NONE;
+            }
+        }
+
+        /**
+         * @brief The ForEachChild() function calls a function with every child of a node, in byte order.
+         * @param node The node
+         * @param function Called with the byte and arena index of every child
+         */
+        template <typename Function>
+        void ForEachChild(const Node& node, Function function) {
+            switch (node.type) {
+                case Node::NODE1:
+                    function((unsigned char) nodes[node.block].m_ch, node.block);
+                    break;
+                case Node::NODE4:
+                    for (int i = 0; i < node.numChildren; i++)
+                        function(node4.blocks[node.block].keys[i], node4.blocks[node.block].children[i]);
+                    break;
+                case Node::NODE16:
+                    for (int i = 0; i < node.numChildren; i++)
+                        function(node16.blocks[node.block].keys[i], node16.blocks[node.block].children[i]);
+                    break;
+                case Node::NODE48:
+                    for (int c = 0; c < 256; c++) {
+                        const Node48& block = node48.blocks[node.block];
+
+                        if (block.index[c] != 0)
+                            function((unsigned char) c, block.children[block.index[c] - 1]);
+                    }
+                    break;
+                case Node::NODE256:
+                    for (int c = 0; c < 256; c++) {
+                        uint32_t child = node256.blocks[node.block].children[c];
+
+                        if (child != Node::NONE)
+                            function((unsigned char) c, child);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /**
+         * @brief The Relayout() function moves the children of a node into a block of another layout.
+         * @param index The arena index of the node
+         * @param type The new layout
+         */
+        void Relayout(uint32_t index, Node::Type type) {
+            unsigned char keys[256];
+            uint32_t children[256];
+            int n = 0;
+
+            ForEachChild(nodes[index], [&](unsigned char c, uint32_t child) {
+                keys[n] = c;
+                children[n++] = child;
+            });
+
+            Node& node = nodes[index];
+
+            switch (node.type) {
+                case Node::NODE4: node4.Free(node.block); break;
+                case Node::NODE16: node16.Free(node.block); break;
+                case Node::NODE48: node48.Free(node.block); break;
+                case Node::NODE256: node256.Free(node.block); break;
+                default: break;
+            }
+
+            node.type = type;
+
+            switch (type) {
+                case Node::NODE1:
+                    node.block = children[0];
+                    break;
+                case Node::NODE4: {
+                    node.block = node4.New();
+                    Node4& block = node4.blocks[node.block];
+                    std::copy(keys, keys + n, block.keys);
+                    std::copy(children, children + n, block.children);
+                    break;
+                }
+                case Node::NODE16: {
+                    node.block = node16.New();
+                    Node16& block = node16.blocks[node.block];
+                    std::copy(keys, keys + n, block.keys);
+                    std::copy(children, children + n, block.children);
+                    break;
+                }
+                case Node::NODE48: {
+                    node.block = node48.New();
+                    Node48& block = node48.blocks[node.block];
+
+                    for (int i = 0; i < n; i++) {
+                        block.index[keys[i]] = (uint8_t) (i + 1);
+                        block.children[i] = children[i];
+                    }
+                    break;
+                }
+                case Node::NODE256: {
+                    node.block = node256.New();
+                    Node256& block = node256.blocks[node.block];
+
+                    for (int i = 0; i < n; i++)
+                        block.children[keys[i]] = children[i];
+                    break;
+                }
+                default:
+                    node.block = 0;
+                    break;
+            }
+        }
+
+        /**
+         * @brief The AddChild() function adds a child to a node, moving to a larger layout when it is full.
+         * @param index The arena index of the node
+         * @param c The byte of the child, which the node must not have yet
+         * @param child The arena index of the child
+         */
+        void AddChild(uint32_t index, unsigned char c, uint32_t child) {
+            int n = nodes[index].numChildren;
+
+            switch (nodes[index].type) {
+                case Node::NODE0:
+                    nodes[index].type = Node::NODE1;
+                    nodes[index].block = child;
+                    nodes[index].numChildren = 1;
+                    return;
+                case Node::NODE1: Relayout(index, Node::NODE4); break;
+                case Node::NODE4: if (n == Node4::CAPACITY) Relayout(index, Node::NODE16); break;
+                case Node::NODE16: if (n == Node16::CAPACITY) Relayout(index, Node::NODE48); break;
+                case Node::NODE48: if (n == Node48::CAPACITY) Relayout(index, Node::NODE256); break;
+                default: break;
+            }
+
+            Node& node = nodes[index];
+            node.numChildren++;
+
+            /// The small layouts keep their keys sorted, so shift the larger ones up
+            auto insertSorted = [&](uint8_t* keys, uint32_t* children) {
+                int i = n;
+
+                for (; i > 0 && keys[i - 1] > c; i--) {
+                    keys[i] = keys[i - 1];
+                    children[i] = children[i - 1];
+                }
+
+                keys[i] = c;
+                children[i] = child;
+            };
+
+            switch (node.type) {
+                case Node::NODE4:
+                    insertSorted(node4.blocks[node.block].keys, node4.blocks[node.block].children);
+                    break;
+                case Node::NODE16:
+                    insertSorted(node16.blocks[node.block].keys, node16.blocks[node.block].children);
+                    break;
+                case Node::NODE48:
+                    node48.blocks[node.block].index[c] = (uint8_t) (n + 1);
+                    node48.blocks[node.block].children[n] = child;
+                    break;
+                default:
+                    node256.blocks[node.block].children[c] = child;
+                    break;
+            }
+        }
+
+        /**
+         * @brief The RemoveChild() function removes a child from a node, moving to a smaller layout once
+         *        the children fit in one with room to spare.
+         * @param index The arena index of the node
+         * @param c The byte of the child to be removed
+         */
+        void RemoveChild(uint32_t index, unsigned char c) {
+            Node& node = nodes[index];
+            int n = node.numChildren;
+
+            /// The small layouts keep their keys sorted, so shift the larger ones down
+            auto removeSorted = [&](uint8_t* keys, uint32_t* children) {
+                int i = 0;
+
+                while (keys[i] != c)
+                    i++;
+
+                for (; i + 1 < n; i++) {
+                    keys[i] = keys[i + 1];
+                    children[i] = children[i + 1];
+                }
+            };
+
+            switch (node.type) {
+                case Node::NODE1:
+                    break;
+                case Node::NODE4:
+                    removeSorted(node4.blocks[node.block].keys, node4.blocks[node.block].children);
+                    break;
+                case Node::NODE16:
+                    removeSorted(node16.blocks[node.block].keys, node16.blocks[node.block].children);
+                    break;
+                case Node::NODE48: {
+                    /// Keep the used slots packed by moving the last one into the hole
+                    Node48& block = node48.blocks[node.block];
+                    int slot = block.index[c] - 1;
+
+                    for (int other = 0; other < 256; other++) {
+                        if (block.index[other] == n) {
+                            block.index[other] = (uint8_t) (slot + 1);
+                            break;
+                        }
+                    }
+
+                    block.children[slot] = block.children[n - 1];
+                    block.index[c] = 0;
+                    break;
+                }
+                case Node::NODE256:
+                    node256.blocks[node.block].children[c] = Node::NONE;
+                    break;
+                default:
+                    return;
+            }
+
+            node.numChildren--;
+            n--;
+
+            switch (node.type) {
+                case Node::NODE1: Relayout(index, Node::NODE0); break;
+                case Node::NODE4: if (n <= 1) Relayout(index, n == 0 ? Node::NODE0 : Node::NODE1); break;
+                case Node::NODE16: if (n <= Node4::CAPACITY - 1) Relayout(index, Node::NODE4); break;
+                case Node::NODE48: if (n <= Node16::CAPACITY - 4) Relayout(index, Node::NODE16); break;
+                case Node::NODE256: if (n <= Node48::CAPACITY - 8) Relayout(index, Node::NODE48); break;
+                default: break;
+            }
+        }
+
+        /**
+         * @brief The NewNode() function takes a node from the free list, or else from the end of the arena.
+         * @param ch Character value of the node
+         * @return Returns the arena index of the node
+         */
+        uint32_t NewNode(char ch) {
+            if (!freeNodes.empty()) {
+                uint32_t index = freeNodes.back();
+                freeNodes.pop_back();
+                nodes[index] = Node(ch);
+
+                return index;
+            }
+
+            if (nodes.size() > UINT32_MAX)
+                throw "Trie arena full";
+
+            nodes.emplace_back(ch);
+
+            return (uint32_t) (nodes.size() - 1);
+        }
+
+        /**
+         * @brief The FreeSubtree() function moves a node and all nodes below it to the free list.
+         * @param index The arena index of the subtree root
+         */
+        void FreeSubtree(uint32_t index) {
+            size_t first = freeNodes.size();
+            freeNodes.push_back(index);
+
+            /// The free list doubles as the work list of the traversal
+            for (size_t i = first; i < freeNodes.size(); i++) {
+                uint32_t node = freeNodes[i];
+
+                ForEachChild(nodes[node], [this](unsigned char, uint32_t child) { freeNodes.push_back(child); });
+                Relayout(node, Node::NODE0);
+            }
+        }
+
+        /**
+         * @brief The UpdateBest() function recomputes the cached best count of every node on the path,
+         *        from the bottom up, after the counts below them changed.
+         */
+        void UpdateBest() {
+            for (size_t i = path.size(); i-- > 0; ) {
+                Node& node = nodes[path[i]];
+                int best = node.ends;
+
+                ForEachChild(node, [&](unsigned char, uint32_t child) { best = std::max(best, nodes[child].best); });
+                node.best = best;
+            }
+        }
 
         /**
          * @brief The Insert() function attempts to insert a string of characters into the Trie.
@@ -31,39 +409,47 @@ class Trie {
          * @param numInserts Number of insertions
          * @return Returns true upon successful insertion
          */
-        bool Insert(std::string& key, int numInserts) {
+        bool Insert(std::string_view key, int numInserts) {
             if (key.empty())
                 throw "Empty string";
             else if (numInserts <= 0)
                 throw "numInserts must be greater than zero";
 
-            Node* node = root;
+            uint32_t node = ROOT;
+            path.assign(1, ROOT);
             bool createdNewNode = false;
             bool isPrefix = false;
 
             /// Process individual characters
-            for (int i = 0; i < key.length(); i++) {
+            for (int i = 0; i < (int) key.length(); i++) {
                 char ch = key[i];
-                Node* nextNode = node->children.at(ch);
+                uint32_t nextNode = Child(nodes[node], ch);
 
                 /// The next character doesn't exist
-                if (nextNode == nullptr) {
-                    nextNode = new Node(ch);
-                    node->AddChild(nextNode, ch);
+                if (nextNode == Node::NONE) {
+                    nextNode = NewNode(ch);
+                    AddChild(node, ch, nextNode);
                     createdNewNode = true;
 
                 /// The next character exists
-                } else if (nextNode->isWordEnding) {
+                } else if (nodes[nextNode].isWordEnding) {
                     isPrefix = true;
                 }
 
                 node = nextNode;
-                node->count += numInserts;
+                nodes[node].count += numInserts;
+                path.push_back(node);
             }
 
             /// Root node cannot be word ending
-            if (node != root)
-                node->isWordEnding = true;
+            if (node != ROOT)
+                nodes[node].isWordEnding = true;
+
+            /// Counts only grow here, so the new count can simply be raised along the path
+            int ends = nodes[node].ends += numInserts;
+
+            for (uint32_t pathNode : path)
+                nodes[pathNode].best = std::max(nodes[pathNode].best, ends);
 
             return isPrefix || !createdNewNode;
         }
@@ -74,134 +460,246 @@ class Trie {
          * @param numDeletions Number of deletions
          * @return Returns true upon successful removal
          */
-        bool Remove(std::string& key, int numDeletions) {
+        bool Remove(std::string_view key, int numDeletions) {
             if (!Contains(key))
                 return false;
 
-            Node* node = root;
+            uint32_t node = ROOT;
+            path.assign(1, ROOT);
 
-            for (int i = 0; i < key.length(); i++) {
+            for (int i = 0; i < (int) key.length(); i++) {
                 char ch = key[i];
-                Node* currentNode = node->children.at(ch);
-                currentNode->count -= numDeletions;
+                uint32_t currentNode = Child(nodes[node], ch);
+                nodes[currentNode].count -= numDeletions;
 
                 /// Cut this edge if the current node has a count <= 0
                 /// This means that all the prefixes below this point are inaccessible
-                if (currentNode->count <= 0) {
-                    /// Free memory of soon to be inaccessible child nodes
-                    for (std::map<char, Node*>::iterator it = currentNode->children.begin(); 
-                        it != currentNode->children.end(); ++it) {
-                        Clear(it->second);
-                    }
-
-                    delete currentNode;
+                if (nodes[currentNode].count <= 0) {
+                    /// Recycle the soon to be inaccessible nodes
+                    FreeSubtree(currentNode);
 
                     /// Reset the child for future entries
-                    node->RemoveChild(ch);
+                    RemoveChild(node, ch);
+                    UpdateBest();
 
                     return true;
                 }
 
                 node = currentNode;
+                path.push_back(node);
             }
 
+            nodes[node].ends = std::max(0, nodes[node].ends - numDeletions);
+            UpdateBest();
+
             return true;
         }
 
+    public:
+        /**
+         * @brief Trie constructor and destructor
+         */
+        Trie() {
+            nodes.emplace_back(rootCharacter);
+        }
+
+        ~Trie() {}
+
+        /**
+         * @brief The public facing Insert() function
+         * @param key The key to be inserted
+         * @return Returns true upon successful insertion
+         */ 
+        bool Insert(std::string_view key) {
+            return Insert(key, 1);
+        }
+
+        /**
+         * @brief The public facing Remove() function
+         * @param key The string to be removed
+         * @return Returns true upon successful removal
+         */
+        bool Remove(std::string_view key) {
+            return Remove(key, 1);
+        }
+
         /**
          * @brief The Count() function gets the count value of a node based on the prefix (key)
          * @param key The string to check the count of
          * @return Returns the count of the prefix
          */
-        int Count(std::string& key) {
+        int Count(std::string_view key) {
             if (key.empty())
                 throw "Empty string";
 
-            Node* node = root;
+            uint32_t node = ROOT;
 
             /// Dig into the Trie until we reach the bottom or our key doesn't exist
-            for (int i = 0; i < key.length(); i++){
-                char ch = key[i];
+            for (int i = 0; i < (int) key.length(); i++) {
+                node = Child(nodes[node], key[i]);
 
-                if (node == nullptr)
+                if (node == Node::NONE)
                     return 0;
-
-                node = node->children.at(ch);
             }
 
-            if (node != nullptr)
-                return node->count;
+            return nodes[node].count;
+        }
 
-            return 0;
+        /**
+         * @brief The Contains() function checks if a string (key) is contained within the Trie.
+         * @param key The string to be checked
+         * @return Returns true if the string (key) is contained within the Trie
+         */
+        bool Contains(std::string_view key) {
+            return Count(key) != 0;
         }
 
         /**
-         * @brief The Clear() function clears all nodes and resets the Trie.
-         * @param node The root node to clear from
+         * @brief The CompletionsOf() function finds the words that start with a prefix and were inserted
+         *        most often, best first. Words with the same count come in no particular order.
+         * @param prefix The prefix to complete, which may be empty to rank all words
+         * @param k The largest number of completions to report
+         * @param callback Receives every completion and the number of times it was inserted
+         * @return Returns the number of completions reported
          */
-        void Clear(Node*& root) {
-            if (root == nullptr)
-                return;
+        int CompletionsOf(std::string_view prefix, int k, const CompletionCallback& callback) {
+            uint32_t start = ROOT;
+
+            for (char ch : prefix) {
+                start = Child(nodes[start], ch);
 
-            for (std::map<char, Node*>::iterator it = root->children.begin(); 
-                it != root->children.end(); ++it) {
-                if (it->second != nullptr) {
-                    Clear(it->second);
+                if (start == Node::NONE)
+                    return 0;
+            }
 
-                    char ch = it->first;
+            /// Every entry is a node reached from the prefix, with the entry of its parent and its char
+            struct Entry {
+                uint32_t node;
+                int parent;
+                char ch;
+            };
+
+            /// A candidate is either a whole subtree, ranked by its best count, or the word of one node
+            struct Candidate {
+                int score;
+                int entry;
+                bool isWord;
+
+                bool operator<(const Candidate& other) const {
+                    return score < other.score;
+                }
+            };
 
-                    delete it->second;
+            std::vector<Entry> entries = { { start, -1, 0 } };
+            std::priority_queue<Candidate> candidates;
+            std::string word(prefix);
+            int reported = 0;
 
-                    /// Reset the child for future entries
-                    root->RemoveChild(ch);
+            if (nodes[start].best > 0)
+                candidates.push({ nodes[start].best, 0, false });
+
+            while (reported < k && !candidates.empty()) {
+                Candidate candidate = candidates.top();
+                candidates.pop();
+
+                /// No candidate left can beat a word that was popped, so it is the next completion
+                if (candidate.isWord) {
+                    word.resize(prefix.size());
+
+                    for (int e = candidate.entry; entries[e].parent != -1; e = entries[e].parent)
+                        word += entries[e].ch;
+
+                    std::reverse(word.begin() + prefix.size(), word.end());
+                    callback(word, candidate.score);
+                    reported++;
+                    continue;
                 }
+
+                const Node& node = nodes[entries[candidate.entry].node];
+
+                if (node.ends > 0 && node.isWordEnding)
+                    candidates.push({ node.ends, candidate.entry, true });
+
+                ForEachChild(node, [&](unsigned char c, uint32_t child) {
+                    if (nodes[child].best > 0) {
+                        entries.push_back({ child, candidate.entry, (char) c });
+                        candidates.push({ nodes[child].best, (int) entries.size() - 1, false });
+                    }
+                });
             }
+
+            return reported;
         }
 
-    public:
         /**
-         * @brief Trie constructor and destructor
+         * @brief The Clear() function removes all nodes by resetting the arena. The arena keeps its
+         *        capacity, so refilling the Trie does not allocate again.
          */
-        Trie() {}
-
-        ~Trie() {
-            Clear(root);
+        void Clear() {
+            nodes.erase(nodes.begin() + 1, nodes.end());
+            nodes[ROOT] = Node(rootCharacter);
+            freeNodes.clear();
+            node4.Clear();
+            node16.Clear();
+            node48.Clear();
+            node256.Clear();
+        }
 
-            delete root;
+        /**
+         * @brief The Freeze() function compiles the Trie into a static double-array trie with the same
+         *        counts and word-ending flags. The Trie itself is left unchanged.
+         * @return Returns the DoubleArrayTrie
+         */
+        DoubleArrayTrie Freeze() {
+            return DoubleArrayTrie(nodes, [this](uint32_t node, auto function) {
+                ForEachChild(nodes[node], function);
+            });
         }
 
         /**
-         * @brief The public facing Insert() function
-         * @param key The key to be inserted
-         * @return Returns true upon successful insertion
-         */ 
-        bool Insert(std::string& key) {
-            return Insert(key, 1);
+         * @brief The Reserve() function grows the arena ahead of time, which avoids copying it while a
+         *        large number of keys is inserted.
+         * @param numNodes The number of nodes below the root to make room for
+         */
+        void Reserve(size_t numNodes) {
+            nodes.reserve(numNodes + 1);
         }
 
         /**
-         * @brief The public facing Remove() function
-         * @param key The string to be removed
-         * @return Returns true upon successful removal
+         * @brief The NodeCount() function returns the number of nodes below the root.
+         * @return Returns the number of nodes
          */
-        bool Remove(std::string& key) {
-            return Remove(key, 1);
+        size_t NodeCount() {
+            return nodes.size() - 1 - freeNodes.size();
         }
 
         /**
-         * @brief The Contains() function checks if a string (key) is contained within the Trie.
-         * @param key The string to be checked
-         * @return Returns true if the string (key) is contained within the Trie
+         * @brief The MemoryUsage() function returns the bytes allocated for the nodes and their children.
+         * @return Returns the memory footprint of the arena, the block pools and the free list in bytes
          */
-        bool Contains(std::string& key) {
-            return Count(key) != 0;
+        size_t MemoryUsage() {
+            return nodes.capacity() * sizeof(Node) + freeNodes.capacity() * sizeof(uint32_t) +
+                node4.MemoryUsage() + node16.MemoryUsage() + node48.MemoryUsage() + node256.MemoryUsage();
         }
 
         /**
-         * @brief The public facing Clear() function
+         * @brief The Stats() function reports the node count and memory use of the Trie.
+         * @return Returns the statistics
          */
-        void Clear() {
-            Clear(root);
+        TrieStats Stats() {
+            TrieStats stats;
+            stats.nodes = NodeCount();
+            stats.freeNodes = freeNodes.size();
+            stats.arenaCapacity = nodes.capacity();
+            stats.node4 = node4.Used();
+            stats.node16 = node16.Used();
+            stats.node48 = node48.Used();
+            stats.node256 = node256.Used();
+            stats.bytesUsed = (stats.nodes + 1) * sizeof(Node) + stats.node4 * sizeof(Node4) +
+                stats.node16 * sizeof(Node16) + stats.node48 * sizeof(Node48) + stats.node256 * sizeof(Node256);
+            stats.bytesReserved = MemoryUsage();
+
+            return stats;
         }
 
-};
\ No newline at end of file
+};
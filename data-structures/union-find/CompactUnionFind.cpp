@@ -0,0 +1,98 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "UnionFind.h"
+#include "CompactUnionFind.h"
+
+/**
+ * @file CompactUnionFind.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the compact Union Find, with a memory and throughput comparison
+ *        against UnionFind
+ */
+
+static int size = 10;                           /// The size of the Union Find
+static int nodes = 10000000;                    /// Number of elements in the benchmark
+static int operations = 20000000;               /// Number of unions and finds in the benchmark
+
+/**
+ * @brief The Benchmark() function runs the same random mix of unions and finds on a Union Find.
+ * @param unionFind The Union Find to be benchmarked
+ * @param pairs Random element pairs; even entries are unified, odd entries are checked
+ * @param connected Receives the number of checked pairs that were connected
+ * @return Returns the number of operations per second
+ */
+template <typename UF>
+double Benchmark(UF& unionFind, std::vector<std::pair<int, int>>& pairs, long long& connected) {
+    connected = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < pairs.size(); i++) {
+        if (i % 2 == 0)
+            unionFind.Unify(pairs[i].first, pairs[i].second);
+        else
+            connected += unionFind.Connected(pairs[i].first, pairs[i].second);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    return pairs.size() / seconds;
+}
+
+int main() {
+    CompactUnionFind<> unionFind(size);
+
+    /// @brief Unify components
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Unifying components..." << std::endl;
+
+    unionFind.Unify(1, 7);
+    unionFind.Unify(2, 7);
+    unionFind.Unify(0, 5);
+    unionFind.Unify(6, 8);
+
+    std::cout << "Union Find size: " << unionFind.Size() << std::endl;
+    std::cout << "Number of components: " << unionFind.Components() << std::endl;
+    std::cout << "Size of component that contains 2: " << unionFind.ComponentSize(2) << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Compare memory and throughput against UnionFind
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> randomNode(0, nodes - 1);
+    std::vector<std::pair<int, int>> pairs(operations);
+
+    for (int i = 0; i < operations; i++)
+        pairs[i] = std::make_pair(randomNode(rng), randomNode(rng));
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << nodes << " elements, " << operations << " operations" << std::endl;
+
+    long long connected = 0;
+
+    {
+        UnionFind original(nodes);
+        double opsPerSecond = Benchmark(original, pairs, connected);
+        printf("UnionFind                  %6.2f bytes/element %8.2f Mops/s %10lld connected\n", 
+            2.0 * sizeof(int), opsPerSecond / 1e6, connected);
+    }
+
+    {
+        CompactUnionFind<int32_t> compact(nodes);
+        double opsPerSecond = Benchmark(compact, pairs, connected);
+        printf("CompactUnionFind<int32_t>  %6.2f bytes/element %8.2f Mops/s %10lld connected\n", 
+            (double) compact.MemoryUsage() / nodes, opsPerSecond / 1e6, connected);
+    }
+
+    {
+        CompactUnionFind<int64_t> compact(nodes);
+        double opsPerSecond = Benchmark(compact, pairs, connected);
+        printf("CompactUnionFind<int64_t>  %6.2f bytes/element %8.2f Mops/s %10lld connected\n", 
+            (double) compact.MemoryUsage() / nodes, opsPerSecond / 1e6, connected);
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
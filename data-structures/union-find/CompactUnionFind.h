@@ -0,0 +1,146 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file CompactUnionFind.h
+ * @author 0xChristopher
+ * @brief This Union Find (Disjoint Set) implementation trades the two arrays of UnionFind for a single
+ *        array of signed indices. A non-negative entry is the parent of an element, while a root stores
+ *        the negated size of its component, so union by size needs no extra storage. Find() uses path
+ *        halving, which points every other node on the path at its grandparent in the same single pass
+ *        that locates the root, instead of walking the path a second time to compress it.
+ *
+ *        The index type is a template parameter: int32_t covers universes of up to 2^31 - 1 elements at
+ *        4 bytes per element, and int64_t lifts that limit at 8 bytes per element.
+ *
+ *        Space Complexity: n * sizeof(Index) bytes
+ *        Time Complexity: O(a(n)) amortized per operation
+ */
+
+template <typename Index = int32_t>
+
+class CompactUnionFind {
+
+    // Check instantiation type (valid: int32_t, int64_t)
+    static_assert(std::is_same<Index, int32_t>::value || std::is_same<Index, int64_t>::value, 
+        "Invalid type");
+
+    private:
+        Index m_size;                   /// The number of elements in the Union Find
+        Index numComponents;            /// The number of components in the union find
+        std::vector<Index> parent;      /// parent[i] is the parent of i, or -(component size) if i is a root
+
+    public:
+        /**
+         * @brief Compact Union Find constructor and destructor
+         * @param size The number of elements in the Union Find
+         */
+        CompactUnionFind(Index size)
+            : m_size(size), numComponents(size) {
+            if (size <= 0)
+                throw "Size 0 or less";
+
+            /// Every element starts as the root of a component of size 1
+            parent.assign(size, -1);
+        }
+
+        ~CompactUnionFind() {}
+
+        /**
+         * @brief The Find() function finds the root of which component 'p' belongs to, halving the path
+         *        on the way up.
+         * @param p The element of a given component
+         * @return Returns the root of the provided element
+         */
+        Index Find(Index p) {
+            while (parent[p] >= 0) {
+                Index next = parent[p];
+
+                /// Skip over the parent if it isn't the root
+                if (parent[next] >= 0) {
+                    parent[p] = parent[next];
+                    next = parent[next];
+                }
+
+                p = next;
+            }
+
+            return p;
+        }
+
+        /**
+         * @brief The Connected() function checks if two elements belong to the same component.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if p and q share the same root
+         */
+        bool Connected(Index p, Index q) {
+            return Find(p) == Find(q);
+        }
+
+        /**
+         * @brief The ComponentSize() function returns the size of a given component.
+         * @param p The element of a given component
+         * @return Returns the size of the component p belongs to
+         */
+        Index ComponentSize(Index p) {
+            return -parent[Find(p)];
+        }
+
+        /**
+         * @brief The Size() function returns the size of the Union Find.
+         * @return Returns the number of elements in the union find
+         */
+        Index Size() {
+            return m_size;
+        }
+
+        /**
+         * @brief The Components() function returns the number of components in the Union Find.
+         * @return Returns the number of components in the union find
+         */
+        Index Components() {
+            return numComponents;
+        }
+
+        /**
+         * @brief The MemoryUsage() function returns the number of bytes used by the element array.
+         * @return Returns the size of the parent array in bytes
+         */
+        size_t MemoryUsage() {
+            return parent.capacity() * sizeof(Index);
+        }
+
+        /**
+         * @brief The Unify() function attempts to unify two components at the larger component's
+         *        root, reducing the total number of components by 1.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if two components were merged
+         */
+        bool Unify(Index p, Index q) {
+            Index root1 = Find(p);
+            Index root2 = Find(q);
+
+            /// Check if these elements are already in the same group
+            if (root1 == root2)
+                return false;
+
+            /// Merge the smaller component into the larger one; sizes are stored negated
+            if (parent[root1] > parent[root2]) {
+                Index tmp = root1;
+                root1 = root2;
+                root2 = tmp;
+            }
+
+            parent[root1] += parent[root2];
+            parent[root2] = root1;
+            numComponents--;
+
+            return true;
+        }
+
+};
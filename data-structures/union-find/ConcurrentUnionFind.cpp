@@ -0,0 +1,90 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include "UnionFind.h"
+#include "ConcurrentUnionFind.h"
+
+/**
+ * @file ConcurrentUnionFind.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration and multi-threaded connected components benchmark of the lock-free
+ *        Union Find
+ */
+
+static int nodes = 1000000;                     /// Number of nodes in the benchmark graph
+static int edges = 5000000;                     /// Number of edges in the benchmark graph
+
+int main() {
+    ConcurrentUnionFind unionFind(10);
+
+    /// @brief Unify components from several threads at once
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Unifying components from two threads..." << std::endl;
+
+    std::thread evens([&unionFind]() { unionFind.Unify(0, 2); unionFind.Unify(2, 4); });
+    std::thread odds([&unionFind]() { unionFind.Unify(1, 3); unionFind.Unify(3, 5); });
+    evens.join();
+    odds.join();
+
+    std::cout << "Number of components: " << unionFind.Components() << std::endl;
+    std::cout << "0 and 4 connected: " << unionFind.Connected(0, 4) << std::endl;
+    std::cout << "0 and 5 connected: " << unionFind.Connected(0, 5) << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Build a random edge list for the benchmark
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> randomNode(0, nodes - 1);
+    std::vector<std::pair<int, int>> edgeList(edges);
+
+    for (int i = 0; i < edges; i++)
+        edgeList[i] = std::make_pair(randomNode(rng), randomNode(rng));
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Connected components of " << nodes << " nodes and " << edges << " edges" << std::endl;
+
+    /// @brief Sequential baseline
+    auto start = std::chrono::steady_clock::now();
+    UnionFind sequential(nodes);
+
+    for (int i = 0; i < edges; i++)
+        sequential.Unify(edgeList[i].first, edgeList[i].second);
+
+    auto end = std::chrono::steady_clock::now();
+    double baseline = std::chrono::duration<double, std::milli>(end - start).count();
+    printf("UnionFind            %3d thread(s) %9.1f ms %8.2f Mops/s  components: %d\n", 1, baseline,
+        edges / baseline / 1000.0, sequential.Components());
+
+    /// @brief Lock-free version with an increasing number of threads
+    int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        ConcurrentUnionFind concurrent(nodes);
+        std::vector<std::thread> threads;
+
+        start = std::chrono::steady_clock::now();
+
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&concurrent, &edgeList, t, threadCount]() {
+                size_t first = edgeList.size() * t / threadCount;
+                size_t last = edgeList.size() * (t + 1) / threadCount;
+
+                for (size_t i = first; i < last; i++)
+                    concurrent.Unify(edgeList[i].first, edgeList[i].second);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        end = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+        printf("ConcurrentUnionFind  %3d thread(s) %9.1f ms %8.2f Mops/s  components: %d\n", threadCount,
+            elapsed, edges / elapsed / 1000.0, concurrent.Components());
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @file ConcurrentUnionFind.h
+ * @author 0xChristopher
+ * @brief This Union Find (Disjoint Set) implementation can be shared by any number of threads without
+ *        locks. All state lives in one array of atomic parent pointers, and every write to it is a single
+ *        compare-and-swap (CAS), in the style of Anderson-Woll and Jayanti-Tarjan:
+ *
+ *        - Find() performs path splitting: every node on the way up is pointed at its grandparent with a
+ *          CAS. A failed CAS only means another thread already shortened the path, so it is ignored.
+ *        - Unify() links one root under the other with a CAS that only succeeds while the node is still
+ *          a root, and retries from the new roots otherwise. Roots are linked by a fixed pseudo-random
+ *          priority derived from their index (randomized linking by index), which keeps trees shallow
+ *          without having to store a rank or size next to each parent pointer.
+ *        - Connected() retries until it sees both roots at the same time, so its answer is consistent
+ *          with concurrent unions.
+ *
+ *        Component sizes are not tracked, since keeping them exact would need a second CAS per union.
+ *
+ *        Time Complexity: O(a(n)) expected per operation, with no locking
+ */
+
+class ConcurrentUnionFind {
+
+    private:
+        int m_size;                                     /// The number of elements in the Union Find
+        std::atomic<int> numComponents;                 /// The number of components in the union find
+        std::unique_ptr<std::atomic<int>[]> id;         /// id[i] points to the parent of i; if id[i] = i, i is a root
+
+        /**
+         * @brief The Priority() function maps an index to its linking priority. Multiplying by an odd
+         *        constant is a bijection on 32 bit integers, so no two roots ever share a priority.
+         * @param p The element
+         * @return Returns the linking priority of p
+         */
+        static uint32_t Priority(int p) {
+            return (uint32_t) p * 0x9E3779B1u;
+        }
+
+    public:
+        /**
+         * @brief Concurrent Union Find constructor and destructor
+         * @param size The number of elements in the Union Find
+         */
+        ConcurrentUnionFind(int size)
+            : m_size(size), numComponents(size) {
+            if (size <= 0)
+                throw "Size 0 or less";
+
+            id.reset(new std::atomic<int>[size]);
+
+            for (int i = 0; i < size; i++)
+                id[i].store(i, std::memory_order_relaxed); /// Its root is itself
+        }
+
+        ~ConcurrentUnionFind() {}
+
+        /**
+         * @brief The Find() function finds the root of which component 'p' belongs to, splitting the path
+         *        on the way up. Only the parent array is shared, so relaxed ordering is sufficient.
+         * @param p The element of a given component
+         * @return Returns the root of the provided element
+         */
+        int Find(int p) {
+            while (true) {
+                int parent = id[p].load(std::memory_order_relaxed);
+                int grandparent = id[parent].load(std::memory_order_relaxed);
+
+                if (parent == grandparent)
+                    return parent;
+
+                /// Point p at its grandparent; losing the race is harmless
+                int expected = parent;
+                id[p].compare_exchange_weak(expected, grandparent, std::memory_order_relaxed);
+
+                p = parent;
+            }
+        }
+
+        /**
+         * @brief The Connected() function checks if two elements belong to the same component.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if p and q share the same root
+         */
+        bool Connected(int p, int q) {
+            while (true) {
+                p = Find(p);
+                q = Find(q);
+
+                if (p == q)
+                    return true;
+
+                /// p is still a root, so the two roots were observed together
+                if (id[p].load(std::memory_order_relaxed) == p)
+                    return false;
+            }
+        }
+
+        /**
+         * @brief The Size() function returns the size of the Union Find.
+         * @return Returns the number of elements in the union find
+         */
+        int Size() {
+            return m_size;
+        }
+
+        /**
+         * @brief The Components() function returns the number of components in the Union Find.
+         * @return Returns the number of components in the union find
+         */
+        int Components() {
+            return numComponents.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief The Unify() function attempts to unify two components, linking the root with the lower
+         *        priority under the other one and reducing the total number of components by 1.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if this call merged two components
+         */
+        bool Unify(int p, int q) {
+            while (true) {
+                p = Find(p);
+                q = Find(q);
+
+                /// Check if these elements are already in the same group
+                if (p == q)
+                    return false;
+
+                if (Priority(p) > Priority(q)) {
+                    int tmp = p;
+                    p = q;
+                    q = tmp;
+                }
+
+                /// Link p under q, but only if no other thread has linked p in the meantime
+                int expected = p;
+
+                if (id[p].compare_exchange_strong(expected, q, std::memory_order_relaxed)) {
+                    numComponents.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+};
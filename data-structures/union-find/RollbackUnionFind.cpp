@@ -0,0 +1,95 @@
+#include <iostream>
+#include <vector>
+#include "RollbackUnionFind.h"
+
+/**
+ * @file RollbackUnionFind.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration of the rollback Union Find, including offline dynamic connectivity
+ *        with a segment tree over time
+ */
+
+static int size = 5;                            /// The size of the Union Find
+
+/// Edge events: {time added, time removed (exclusive), p, q}
+std::vector<std::vector<int>> events = {{0, 3, 0, 1}, {1, 5, 1, 2}, {2, 4, 3, 4}, {4, 6, 0, 4}};
+static int timeSteps = 6;                       /// Number of time steps in the offline example
+
+/**
+ * @brief The AddInterval() function stores an edge in every segment tree node fully covered by the
+ *        edge's lifetime [from, to).
+ */
+void AddInterval(std::vector<std::vector<int>>& tree, int node, int left, int right, int from, int to, 
+    int edge) {
+    if (to <= left || right <= from)
+        return;
+
+    if (from <= left && right <= to) {
+        tree[node].emplace_back(edge);
+        return;
+    }
+
+    int middle = (left + right) / 2;
+    AddInterval(tree, 2 * node, left, middle, from, to, edge);
+    AddInterval(tree, 2 * node + 1, middle, right, from, to, edge);
+}
+
+/**
+ * @brief The Solve() function walks the segment tree over time, applying the edges of a node on the way
+ *        down and rolling them back on the way up, and records the number of components at every leaf.
+ */
+void Solve(std::vector<std::vector<int>>& tree, RollbackUnionFind& unionFind, int node, int left, 
+    int right, std::vector<int>& answers) {
+    int snapshot = unionFind.Snapshot();
+
+    for (int edge : tree[node])
+        unionFind.Unify(events[edge][2], events[edge][3]);
+
+    if (right - left == 1) {
+        answers[left] = unionFind.Components();
+    } else {
+        int middle = (left + right) / 2;
+        Solve(tree, unionFind, 2 * node, left, middle, answers);
+        Solve(tree, unionFind, 2 * node + 1, middle, right, answers);
+    }
+
+    unionFind.Rollback(snapshot);
+}
+
+int main() {
+    RollbackUnionFind unionFind(size);
+
+    /// @brief Unify components, then undo them
+    std::cout << "------------------------------------------------------" << std::endl;
+    unionFind.Unify(0, 1);
+    int snapshot = unionFind.Snapshot();
+
+    unionFind.Unify(1, 2);
+    unionFind.Unify(3, 4);
+    std::cout << "Number of components after unions: " << unionFind.Components() << std::endl;
+    std::cout << "0 and 2 connected: " << unionFind.Connected(0, 2) << std::endl;
+
+    unionFind.Rollback(snapshot);
+    std::cout << "Number of components after rollback: " << unionFind.Components() << std::endl;
+    std::cout << "0 and 2 connected: " << unionFind.Connected(0, 2) << std::endl;
+    std::cout << "0 and 1 connected: " << unionFind.Connected(0, 1) << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Offline dynamic connectivity: number of components at every time step
+    std::cout << "------------------------------------------------------" << std::endl;
+    RollbackUnionFind offline(size);
+    std::vector<std::vector<int>> tree(4 * timeSteps);
+    std::vector<int> answers(timeSteps);
+
+    for (int i = 0; i < (int) events.size(); i++)
+        AddInterval(tree, 1, 0, timeSteps, events[i][0], events[i][1], i);
+
+    Solve(tree, offline, 1, 0, timeSteps, answers);
+
+    for (int t = 0; t < timeSteps; t++)
+        std::cout << "Components at time " << t << ": " << answers[t] << std::endl;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    std::cin.get();
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @file RollbackUnionFind.h
+ * @author 0xChristopher
+ * @brief This Union Find (Disjoint Set) implementation can undo its most recent unions in LIFO order,
+ *        which is what offline dynamic connectivity (a segment tree over time) and bipartiteness checks
+ *        need. Path compression would rewrite many parent pointers per Find and make undoing expensive,
+ *        so it is not used; union by size alone keeps every tree O(log n) deep. Each successful Unify()
+ *        pushes the root it attached onto a history stack. Snapshot() returns the current height of that
+ *        stack, and Rollback() pops unions until the stack is back to a snapshot, restoring one parent
+ *        pointer, one size and the component count per union.
+ *
+ *        Time Complexity:
+ *              Find/Connected/Unify    O(log n)
+ *              Rollback                O(1) per undone union
+ */
+
+class RollbackUnionFind {
+
+    private:
+        int m_size;                     /// The number of elements in the Union Find
+        int numComponents;              /// The number of components in the union find
+        std::vector<int> sz;            /// Tracks the size of each component
+        std::vector<int> id;            /// id[i] points to the parent of i; if id[i] = i, then its root is itself
+        std::vector<int> history;       /// Roots attached by each successful union, most recent last
+
+    public:
+        /**
+         * @brief Rollback Union Find constructor and destructor
+         * @param size The number of elements in the Union Find
+         */
+        RollbackUnionFind(int size)
+            : m_size(size) {
+            if (size <= 0)
+                throw "Size 0 or less";
+
+            numComponents = size;
+            sz.resize(size);
+            id.resize(size);
+
+            for (int i = 0; i < size; i++) {
+                id[i] = i; /// Its root is itself
+                sz[i] = 1; /// Each component is originally size 1
+            }
+        }
+
+        ~RollbackUnionFind() {}
+
+        /**
+         * @brief The Find() function finds the root of which component 'p' belongs to. The path is left
+         *        untouched so that unions stay cheap to undo.
+         * @param p The element of a given component
+         * @return Returns the root of the provided element
+         */
+        int Find(int p) {
+            while (p != id[p])
+                p = id[p];
+
+            return p;
+        }
+
+        /**
+         * @brief The Connected() function checks if two elements belong to the same component.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if p and q share the same root
+         */
+        bool Connected(int p, int q) {
+            return Find(p) == Find(q);
+        }
+
+        /**
+         * @brief The ComponentSize() function returns the size of a given component.
+         * @param p The element of a given component
+         * @return Returns the size of the component p belongs to
+         */
+        int ComponentSize(int p) {
+            return sz[Find(p)];
+        }
+
+        /**
+         * @brief The Size() function returns the size of the Union Find.
+         * @return Returns the number of elements in the union find
+         */
+        int Size() {
+            return m_size;
+        }
+
+        /**
+         * @brief The Components() function returns the number of components in the Union Find.
+         * @return Returns the number of components in the union find
+         */
+        int Components() {
+            return numComponents;
+        }
+
+        /**
+         * @brief The Unify() function attempts to unify two components at the larger component's
+         *        root, reducing the total number of components by 1, and records the union.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if two components were merged
+         */
+        bool Unify(int p, int q) {
+            int root1 = Find(p);
+            int root2 = Find(q);
+
+            /// Check if these elements are already in the same group
+            if (root1 == root2)
+                return false;
+
+            /// Attach the smaller component under the larger one
+            if (sz[root1] < sz[root2]) {
+                int tmp = root1;
+                root1 = root2;
+                root2 = tmp;
+            }
+
+            id[root2] = root1;
+            sz[root1] += sz[root2];
+            numComponents--;
+            history.emplace_back(root2);
+
+            return true;
+        }
+
+        /**
+         * @brief The Snapshot() function marks the current state so it can be restored later.
+         * @return Returns the number of unions performed so far
+         */
+        int Snapshot() {
+            return (int) history.size();
+        }
+
+        /**
+         * @brief The Rollback() function undoes every union performed after a snapshot, most recent
+         *        first.
+         * @param snapshot A value previously returned by Snapshot()
+         */
+        void Rollback(int snapshot) {
+            if (snapshot < 0 || snapshot > (int) history.size())
+                throw "Invalid snapshot";
+
+            while ((int) history.size() > snapshot) {
+                int child = history.back();
+                int parent = id[child];
+
+                history.pop_back();
+                sz[parent] -= sz[child];
+                id[child] = child;
+                numComponents++;
+            }
+        }
+
+};
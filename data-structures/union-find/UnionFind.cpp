@@ -1,4 +1,6 @@
 #include <iostream>
+#include <random>
+#include <chrono>
 #include "UnionFind.h"
 
 /**
@@ -10,6 +12,17 @@
 
 static int size = 10;                           /// The size of the Union Find
 int set[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};     /// The elements within the Union Find
+static int nodes = 10000000;                    /// Number of elements in the batch benchmark
+static int batchSize = 20000000;                /// Number of pairs in the batch benchmark
+
+/**
+ * @brief The Elapsed() function returns the milliseconds passed since 'start'.
+ * @param start The start time
+ * @return Returns the elapsed time in milliseconds
+ */
+double Elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 
 int main() {
     UnionFind unionFind(size);
@@ -45,5 +58,63 @@ int main() {
     std::cout << "Size of component that contains 6: " << unionFind.ComponentSize(set[5]) << std::endl;
     std::cout << "------------------------------------------------------" << std::endl;
 
+    /// @brief Label components with dense ids
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::vector<int> labels = unionFind.ComponentLabels();
+
+    std::cout << "Component labels: ";
+
+    for (int i = 0; i < size; i++)
+        std::cout << labels[i] << " ";
+
+    std::cout << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    /// @brief Compare single operations against the batch API
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> randomNode(0, nodes - 1);
+    std::vector<std::pair<int, int>> pairs(batchSize);
+    std::vector<bool> results;
+
+    for (int i = 0; i < batchSize; i++)
+        pairs[i] = std::make_pair(randomNode(rng), randomNode(rng));
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << nodes << " elements, " << batchSize << " pairs" << std::endl;
+
+    UnionFind single(nodes);
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < batchSize / 2; i++)
+        single.Unify(pairs[i].first, pairs[i].second);
+
+    printf("Unify           %8.2f Mops/s\n", batchSize / 2 / Elapsed(start) / 1000.0);
+
+    start = std::chrono::steady_clock::now();
+    results.resize(batchSize / 2);
+
+    for (int i = batchSize / 2; i < batchSize; i++)
+        results[i - batchSize / 2] = single.Connected(pairs[i].first, pairs[i].second);
+
+    printf("Connected       %8.2f Mops/s\n", batchSize / 2 / Elapsed(start) / 1000.0);
+
+    UnionFind batched(nodes);
+    std::vector<std::pair<int, int>> unions(pairs.begin(), pairs.begin() + batchSize / 2);
+    std::vector<std::pair<int, int>> queries(pairs.begin() + batchSize / 2, pairs.end());
+
+    start = std::chrono::steady_clock::now();
+    batched.UnifyBatch(unions);
+    printf("UnifyBatch      %8.2f Mops/s\n", batchSize / 2 / Elapsed(start) / 1000.0);
+
+    start = std::chrono::steady_clock::now();
+    batched.ConnectedBatch(queries, results);
+    printf("ConnectedBatch  %8.2f Mops/s\n", batchSize / 2 / Elapsed(start) / 1000.0);
+
+    start = std::chrono::steady_clock::now();
+    labels = batched.ComponentLabels();
+    printf("ComponentLabels %8.2f Melements/s (%d components)\n", nodes / Elapsed(start) / 1000.0, 
+        batched.Components());
+    std::cout << "------------------------------------------------------" << std::endl;
+
     std::cin.get();
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <utility>
 
 /**
  * @file UnionFind.h
@@ -12,6 +13,11 @@
  *        the current number of components, check the size of each component, as well as unify
  *        two components that do not already belong to the same set. Additionally, when finding
  *        the root of a component, path compression will be performed to optimize future lookups.
+ *
+ *        For streams of edges, UnifyBatch() and ConnectedBatch() do a single find per endpoint, and
+ *        both first group the batch by the block of the id array its first endpoint falls in, so
+ *        consecutive finds hit the same cache lines. ComponentLabels() turns the forest into a dense
+ *        component id per element in one pass.
  * 
  *        Time Complexity (Without Path Compression): O(n)
  *        Time Complexity (With Path Compression): O(a(n)) 
@@ -20,12 +26,32 @@
 class UnionFind {
 
     private:
+        static const int BLOCK_SHIFT = 10;  /// 1024 ids (4 KiB) per block of a batch
+
         int m_size;                     /// The number of elements in the Union Find
         int numComponents;              /// The number of components in the union find
-        int root, root1, root2;         /// Component roots
         std::vector<int> sz;            /// Tracks the size of each component
         std::vector<int> id;            /// id[i] points to the parent of i; if id[i] = i, then its root is itself
 
+        /**
+         * @brief The BlockOffsets() function counts the pairs of a batch per block of the id array their
+         *        first element falls in, the first half of a counting sort by block.
+         * @param pairs The pairs of a batch
+         * @return Returns the position in block order of the first pair of every block
+         */
+        std::vector<size_t> BlockOffsets(const std::vector<std::pair<int, int>>& pairs) const {
+            int blocks = (m_size >> BLOCK_SHIFT) + 1;
+            std::vector<size_t> offsets(blocks + 1, 0);
+
+            for (size_t i = 0; i < pairs.size(); i++)
+                offsets[(pairs[i].first >> BLOCK_SHIFT) + 1]++;
+
+            for (int b = 0; b < blocks; b++)
+                offsets[b + 1] += offsets[b];
+
+            return offsets;
+        }
+
     public:
         /**
          * @brief Union Find constructor and destructor
@@ -54,7 +80,7 @@ class UnionFind {
          * @return Returns the root of the provided element
          */
         int Find(int p) {
-            root = p;
+            int root = p;
 
             while (root != id[root])
                 root = id[root];
@@ -107,14 +133,17 @@ class UnionFind {
         /**
          * @brief The Unify() function attempts to unify two components at the larger component's
          * root, reducing the total number of components by 1.
+         * @param p The element of a given component
+         * @param q The element of a given component
+         * @return Returns true if two components were merged
          */
-        void Unify(int p, int q) {
-            /// Check if these elements are already in the same group
-            if (Connected(p, q))
-                return;
+        bool Unify(int p, int q) {
+            int root1 = Find(p);
+            int root2 = Find(q);
 
-            root1 = Find(p);
-            root2 = Find(q);
+            /// Check if these elements are already in the same group
+            if (root1 == root2)
+                return false;
 
             /// Merge the smaller component into the larger one
             if (sz[root1] < sz[root2]) {
@@ -128,6 +157,89 @@ class UnionFind {
             }
 
             numComponents--;
-        }        
+
+            return true;
+        }
+
+        /**
+         * @brief The UnifyBatch() function unifies every pair of a batch. The batch is reordered in place
+         *        by the block of the id array its first element falls in, which keeps consecutive finds
+         *        close together in memory; the resulting components do not depend on the order.
+         * @param pairs The pairs of elements to unify
+         * @return Returns the number of components merged by the batch
+         */
+        int UnifyBatch(std::vector<std::pair<int, int>>& pairs) {
+            if ((m_size >> BLOCK_SHIFT) > 0 && pairs.size() > 1) {
+                std::vector<size_t> offsets = BlockOffsets(pairs);
+                std::vector<std::pair<int, int>> sorted(pairs.size());
+
+                for (size_t i = 0; i < pairs.size(); i++)
+                    sorted[offsets[pairs[i].first >> BLOCK_SHIFT]++] = pairs[i];
+
+                pairs.swap(sorted);
+            }
+
+            int merged = 0;
+
+            for (size_t i = 0; i < pairs.size(); i++)
+                merged += Unify(pairs[i].first, pairs[i].second);
+
+            return merged;
+        }
+
+        /**
+         * @brief The ConnectedBatch() function checks every pair of a batch, doing a single find per
+         *        element. The pairs are visited by the block of the id array their first element falls in,
+         *        and every result is written back to the position of its pair.
+         * @param pairs The pairs of elements to check
+         * @param results Receives, in batch order, true for every pair that shares a component
+         */
+        void ConnectedBatch(const std::vector<std::pair<int, int>>& pairs, std::vector<bool>& results) {
+            results.resize(pairs.size());
+
+            if ((m_size >> BLOCK_SHIFT) == 0 || pairs.size() <= 1) {
+                for (size_t i = 0; i < pairs.size(); i++)
+                    results[i] = Find(pairs[i].first) == Find(pairs[i].second);
+
+                return;
+            }
+
+            /// Each pair is sorted along with its position, so the sorted batch is read front to back
+            struct Entry {
+                std::pair<int, int> pair;
+                size_t position;
+            };
+
+            std::vector<size_t> offsets = BlockOffsets(pairs);
+            std::vector<Entry> sorted(pairs.size());
+
+            for (size_t i = 0; i < pairs.size(); i++)
+                sorted[offsets[pairs[i].first >> BLOCK_SHIFT]++] = { pairs[i], i };
+
+            for (const Entry& entry : sorted)
+                results[entry.position] = Find(entry.pair.first) == Find(entry.pair.second);
+        }
+
+        /**
+         * @brief The ComponentLabels() function labels every element with a dense component id in
+         *        [0, Components()), numbered in order of each component's first element.
+         * @return Returns the component id of every element
+         */
+        std::vector<int> ComponentLabels() {
+            std::vector<int> labels(m_size, -1);
+            int nextLabel = 0;
+
+            /// A root's own entry doubles as its component's label, so no second array is needed
+            for (int i = 0; i < m_size; i++) {
+                int root = Find(i);
+
+                if (labels[root] == -1)
+                    labels[root] = nextLabel++;
+
+                labels[i] = labels[root];
+            }
+
+            return labels;
+        }
 
 };
\ No newline at end of file
@@ -15,16 +15,13 @@ DijkstrasAdjacencyList::DijkstrasAdjacencyList(int nodeCount)
 {
     // Create graph and resize the distance, previous node, and visited vectors for efficiency
     this->graph = CreateEmptyGraph(nodeCount);
+    this->reverseGraph = this->graph;
     this->dist.resize(nodeCount);
     this->prev.resize(nodeCount);
     this->visited.resize(nodeCount);
+    this->affected.resize(nodeCount, false);
 
-    for (int i = 0; i < nodeCount; i++)
-    {
-        this->dist[i] = INFINITY;                   // Set all distances to infinity
-        this->prev[i] = -1;                         // Set all previous node values to -1
-        this->visited[i] = false;                   // Set visited values to false until traversed
-    }
+    ResetSearchState();
 }
 
 DijkstrasAdjacencyList::~DijkstrasAdjacencyList()
@@ -58,14 +55,136 @@ int DijkstrasAdjacencyList::Compare(Node node1, Node node2)
 }
 
 /**
- * @brief The AddEdge() function adds an edge to the graph.
+ * @brief The MinFirst() function orders the priority queue so that the node with the smallest distance
+ *      is at the top.
+ */
+int DijkstrasAdjacencyList::MinFirst(Node node1, Node node2)
+{
+    return Compare(node1, node2) > 0;
+}
+
+/**
+ * @brief The ResetSearchState() function resets the distance, previous node and visited vectors so a
+ *      new search can be run from scratch.
+ */
+void DijkstrasAdjacencyList::ResetSearchState()
+{
+    for (int i = 0; i < m_nodeCount; i++)
+    {
+        this->dist[i] = INFINITY;                   // Set all distances to infinity
+        this->prev[i] = -1;                         // Set all previous node values to -1
+        this->visited[i] = false;                   // Set visited values to false until traversed
+    }
+}
+
+/**
+ * @brief The AddEdge() function adds an edge to the graph. If a shortest path tree is being
+ *      maintained, it is repaired.
  */
 void DijkstrasAdjacencyList::AddEdge(int from, int to, double cost)
 {
+    if (cost < 0)
+        throw "Negative edge weight";
+
     auto it = graph.find(from);
+    auto reverseIt = reverseGraph.find(to);
     
-    if (it != graph.end())
-        it->second.emplace_back(from, to, cost);
+    if (it == graph.end() || reverseIt == reverseGraph.end())
+        return;
+
+    it->second.emplace_back(from, to, cost);
+    reverseIt->second.emplace_back(from, to, cost);
+
+    if (hasTree)
+        lastRepairCount = RepairDecrease(from, to, cost);
+}
+
+/**
+ * @brief The UpdateEdgeWeight() function changes the weight of the first edge from 'from' to 'to'. If
+ *      a shortest path tree is being maintained, it is repaired.
+ */
+bool DijkstrasAdjacencyList::UpdateEdgeWeight(int from, int to, double cost)
+{
+    if (cost < 0)
+        throw "Negative edge weight";
+
+    auto it = graph.find(from);
+    auto reverseIt = reverseGraph.find(to);
+
+    if (it == graph.end() || reverseIt == reverseGraph.end())
+        return false;
+
+    for (auto edgeIt = it->second.begin(); edgeIt != it->second.end(); ++edgeIt)
+    {
+        if (edgeIt->m_to != to)
+            continue;
+
+        double oldCost = edgeIt->m_cost;
+        edgeIt->m_cost = cost;
+
+        // Keep the matching incoming edge in sync
+        for (auto inIt = reverseIt->second.begin(); inIt != reverseIt->second.end(); ++inIt)
+        {
+            if (inIt->m_from == from && inIt->m_cost == oldCost)
+            {
+                inIt->m_cost = cost;
+                break;
+            }
+        }
+
+        if (hasTree)
+        {
+            if (cost < oldCost)
+                lastRepairCount = RepairDecrease(from, to, cost);
+            else if (cost > oldCost)
+                lastRepairCount = RepairIncrease(from, to);
+            else
+                lastRepairCount = 0;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief The RemoveEdge() function removes the first edge from 'from' to 'to'. If a shortest path tree
+ *      is being maintained, it is repaired.
+ */
+bool DijkstrasAdjacencyList::RemoveEdge(int from, int to)
+{
+    auto it = graph.find(from);
+    auto reverseIt = reverseGraph.find(to);
+
+    if (it == graph.end() || reverseIt == reverseGraph.end())
+        return false;
+
+    for (auto edgeIt = it->second.begin(); edgeIt != it->second.end(); ++edgeIt)
+    {
+        if (edgeIt->m_to != to)
+            continue;
+
+        double oldCost = edgeIt->m_cost;
+        it->second.erase(edgeIt);
+
+        // Remove the matching incoming edge as well
+        for (auto inIt = reverseIt->second.begin(); inIt != reverseIt->second.end(); ++inIt)
+        {
+            if (inIt->m_from == from && inIt->m_cost == oldCost)
+            {
+                reverseIt->second.erase(inIt);
+                break;
+            }
+        }
+
+        if (hasTree)
+            lastRepairCount = RepairIncrease(from, to);
+
+        return true;
+    }
+
+    return false;
 }
 
 /**
@@ -81,11 +200,15 @@ std::unordered_map<int, std::list<Edge>> DijkstrasAdjacencyList::GetGraph()
  */
 double DijkstrasAdjacencyList::Dijkstras(int start, int end)
 {
+    // Early stopping leaves a partial tree, so any maintained tree is dropped
+    hasTree = false;
+    ResetSearchState();
+
     // Set the starting node distance to 0
     dist[start] = 0;
 
     // Keep a priority queue of the next most promising node
-    std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>> pq(Compare);
+    std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>> pq(MinFirst);
     pq.emplace(Node(start, 0.0));
 
     while (!pq.empty())
@@ -100,11 +223,11 @@ double DijkstrasAdjacencyList::Dijkstras(int start, int end)
 
         // Get the edge list of the current node
         auto it = graph.find(node.m_id);
-        std::list<Edge> edges = it->second;
+        const std::list<Edge>& edges = it->second;
 
         for (auto edgeIt = edges.begin(); edgeIt != edges.end(); ++edgeIt)
         {
-            Edge edge = *edgeIt;
+            const Edge& edge = *edgeIt;
 
             // Check if we've already visited this node
             if (visited[edge.m_to])
@@ -131,18 +254,201 @@ double DijkstrasAdjacencyList::Dijkstras(int start, int end)
     return INFINITY;
 }
 
+/**
+ * @brief The Settle() function runs Dijkstra's algorithm from the nodes already in the priority
+ *      queue, relaxing edges until the queue is empty.
+ */
+int DijkstrasAdjacencyList::Settle(std::priority_queue<Node, std::vector<Node>, 
+    std::function<int(Node, Node)>>& pq)
+{
+    int settled = 0;
+
+    while (!pq.empty())
+    {
+        Node node = pq.top();
+        pq.pop();
+
+        // Check if we've already found a better distance
+        if (dist[node.m_id] < node.m_value)
+            continue;
+
+        settled++;
+
+        const std::list<Edge>& edges = graph.find(node.m_id)->second;
+
+        for (auto edgeIt = edges.begin(); edgeIt != edges.end(); ++edgeIt)
+        {
+            // Try to relax the current edge
+            double newDist = dist[edgeIt->m_from] + edgeIt->m_cost;
+
+            if (newDist < dist[edgeIt->m_to])
+            {
+                prev[edgeIt->m_to] = edgeIt->m_from;
+                dist[edgeIt->m_to] = newDist;
+                pq.emplace(Node(edgeIt->m_to, newDist));
+            }
+        }
+    }
+
+    return settled;
+}
+
+/**
+ * @brief The ComputeShortestPaths() function computes the full shortest path tree from 'start' and
+ *      keeps it up to date under subsequent edge updates.
+ */
+void DijkstrasAdjacencyList::ComputeShortestPaths(int start)
+{
+    if ((start < 0) || (start >= m_nodeCount))
+        throw "Invalid node index";
+
+    ResetSearchState();
+    dist[start] = 0;
+
+    std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>> pq(MinFirst);
+    pq.emplace(Node(start, 0.0));
+
+    fullComputeCount = Settle(pq);
+    lastRepairCount = fullComputeCount;
+    source = start;
+    hasTree = true;
+}
+
+/**
+ * @brief The RepairDecrease() function repairs the shortest path tree after an edge has been added
+ *      or its weight has been decreased.
+ */
+int DijkstrasAdjacencyList::RepairDecrease(int from, int to, double cost)
+{
+    // Only a strictly shorter path through the edge can change the tree
+    if (dist[from] + cost >= dist[to])
+        return 0;
+
+    dist[to] = dist[from] + cost;
+    prev[to] = from;
+
+    // Propagate the improvement forward; only nodes that get closer are settled again
+    std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>> pq(MinFirst);
+    pq.emplace(Node(to, dist[to]));
+
+    return Settle(pq);
+}
+
+/**
+ * @brief The RepairIncrease() function repairs the shortest path tree after an edge has been removed
+ *      or its weight has been increased.
+ */
+int DijkstrasAdjacencyList::RepairIncrease(int from, int to)
+{
+    // Distances can only change if the edge was part of the tree
+    if (prev[to] != from)
+        return 0;
+
+    // Collect the subtree hanging off the edge; these are the only nodes whose distance may grow
+    std::vector<int> subtree;
+    subtree.emplace_back(to);
+    affected[to] = true;
+
+    for (int i = 0; i < (int) subtree.size(); i++)
+    {
+        int node = subtree[i];
+        const std::list<Edge>& edges = graph.find(node)->second;
+
+        for (auto edgeIt = edges.begin(); edgeIt != edges.end(); ++edgeIt)
+        {
+            if (prev[edgeIt->m_to] == node && !affected[edgeIt->m_to])
+            {
+                affected[edgeIt->m_to] = true;
+                subtree.emplace_back(edgeIt->m_to);
+            }
+        }
+    }
+
+    for (int i = 0; i < (int) subtree.size(); i++)
+    {
+        dist[subtree[i]] = INFINITY;
+        prev[subtree[i]] = -1;
+    }
+
+    // Reseed every affected node from its best incoming edge outside of the subtree
+    std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>> pq(MinFirst);
+
+    for (int i = 0; i < (int) subtree.size(); i++)
+    {
+        int node = subtree[i];
+        const std::list<Edge>& edges = reverseGraph.find(node)->second;
+
+        for (auto edgeIt = edges.begin(); edgeIt != edges.end(); ++edgeIt)
+        {
+            if (affected[edgeIt->m_from])
+                continue;
+
+            double newDist = dist[edgeIt->m_from] + edgeIt->m_cost;
+
+            if (newDist < dist[node])
+            {
+                dist[node] = newDist;
+                prev[node] = edgeIt->m_from;
+            }
+        }
+
+        if (dist[node] != INFINITY)
+            pq.emplace(Node(node, dist[node]));
+    }
+
+    for (int i = 0; i < (int) subtree.size(); i++)
+        affected[subtree[i]] = false;
+
+    // Settle the subtree again; relaxations can only lower affected nodes
+    Settle(pq);
+
+    return (int) subtree.size();
+}
+
+/**
+ * @brief The GetDistance() function returns the distance of a node in the maintained shortest path
+ *      tree.
+ */
+double DijkstrasAdjacencyList::GetDistance(int node)
+{
+    if (!hasTree)
+        throw "No shortest path tree has been computed";
+    else if ((node < 0) || (node >= m_nodeCount))
+        throw "Invalid node index";
+
+    return dist[node];
+}
+
+/**
+ * @brief The GetLastRepairCount() function returns the number of nodes touched by the last repair.
+ */
+int DijkstrasAdjacencyList::GetLastRepairCount()
+{
+    return lastRepairCount;
+}
+
+/**
+ * @brief The GetFullComputeCount() function returns the number of nodes settled by the last call to
+ *      ComputeShortestPaths(), which is the cost a full recompute would have.
+ */
+int DijkstrasAdjacencyList::GetFullComputeCount()
+{
+    return fullComputeCount;
+}
+
 /**
  * @brief The ReconstructPath() function reconstructs the shortest path from the 'start' node to the
  *      'end' node.
  */
 std::list<int> DijkstrasAdjacencyList::ReconstructPath(int start, int end)
 {
-    if ((end < 0) || (end > m_nodeCount))
+    if ((end < 0) || (end >= m_nodeCount))
         throw "Invalid node index";
-    else if ((start < 0) || (start > m_nodeCount))
+    else if ((start < 0) || (start >= m_nodeCount))
         throw "Invalid node index";
 
-    double dist = Dijkstras(start, end);
+    // Reuse the maintained shortest path tree when it was computed from the same source
+    double dist = (hasTree && start == source) ? this->dist[end] : Dijkstras(start, end);
     std::list<int> path;
 
     // Check if the node we're trying to get to is reachable
@@ -201,5 +507,42 @@ int main()
 
     dalist.PrintInfo();
 
+    // Maintain a shortest path tree on a larger random graph under weight updates
+    std::cout << "\n\n------------------------------------------------------" << std::endl;
+    std::cout << "Incremental shortest path repair..." << std::endl;
+
+    int nodes = 20000;                          // Number of nodes in the random graph
+    int edges = 100000;                         // Number of edges in the random graph
+    int updates = 1000;                         // Number of weight updates to apply
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> randomNode(0, nodes - 1);
+    std::uniform_real_distribution<double> randomCost(1.0, 100.0);
+    std::vector<std::pair<int, int>> edgeList;
+    DijkstrasAdjacencyList traffic(nodes);
+
+    for (int i = 0; i < edges; i++)
+    {
+        int from = randomNode(rng);
+        int to = randomNode(rng);
+
+        traffic.AddEdge(from, to, randomCost(rng));
+        edgeList.emplace_back(from, to);
+    }
+
+    traffic.ComputeShortestPaths(0);
+    long long touched = 0;
+
+    for (int i = 0; i < updates; i++)
+    {
+        std::pair<int, int> edge = edgeList[rng() % edgeList.size()];
+
+        traffic.UpdateEdgeWeight(edge.first, edge.second, randomCost(rng));
+        touched += traffic.GetLastRepairCount();
+    }
+
+    std::cout << "Nodes settled by a full recompute: " << traffic.GetFullComputeCount() << std::endl;
+    std::cout << "Average nodes touched per repair: " << (double) touched / updates << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
     return 0;
 }
\ No newline at end of file
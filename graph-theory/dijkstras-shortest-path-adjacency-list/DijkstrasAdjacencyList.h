@@ -7,6 +7,7 @@
 #include <math.h>
 #include <queue>
 #include <functional>
+#include <random>
 
 #include "../dijkstras-shortest-path-adjacency-list/Edge.h"
 #include "../dijkstras-shortest-path-adjacency-list/Node.h"
@@ -19,8 +20,18 @@
  *      shortest path from a given start node to a given end node if such a path is possible. In this
  *      implementation, the algorithm stops early if the end node is found before exploring every node
  *      in the graph.
+ *
+ *      The class can also maintain a full shortest path tree from a single source under edge updates.
+ *      After ComputeShortestPaths() has been called, AddEdge(), UpdateEdgeWeight() and RemoveEdge()
+ *      repair the last 'dist'/'prev' tree instead of recomputing it, in the style of Ramalingam and Reps:
+ *      a cheaper edge only propagates improvements forward from its target, while a more expensive or
+ *      removed tree edge invalidates the subtree below it, which is then reseeded from its incoming
+ *      edges and settled again. Only nodes whose distance can change are touched, and the number of
+ *      nodes touched by the last repair is reported by GetLastRepairCount().
  * 
  *      Time Complexity: O(V+E)
+ *      Repair Time Complexity: O(A*log(A) + E(A)) where A is the number of affected nodes and E(A) the
+ *          number of edges incident to them
  */
 
 class DijkstrasAdjacencyList
@@ -32,7 +43,13 @@ class DijkstrasAdjacencyList
     std::vector<double> dist;                                   // Minimum distance between nodes
     std::vector<int> prev;                                      // Used to reconstruct the shorted path
     std::vector<bool> visited;                                  // Keep track of visited nodes
+    std::vector<bool> affected;                                 // Nodes invalidated by the current repair
     std::unordered_map<int, std::list<Edge>> graph;             // Adjacency list of graph
+    std::unordered_map<int, std::list<Edge>> reverseGraph;      // Incoming edges of each node
+    bool hasTree = false;                                       // True while 'dist'/'prev' form a full tree
+    int source = -1;                                            // Source node of the maintained tree
+    int lastRepairCount = 0;                                    // Nodes touched by the last repair
+    int fullComputeCount = 0;                                   // Nodes settled by the last full computation
 
     /**
      * @brief The CreateEmptyGraph() function creates an empty graph.
@@ -49,6 +66,49 @@ class DijkstrasAdjacencyList
      */
     static int Compare(Node node1, Node node2);
 
+    /**
+     * @brief The MinFirst() function orders the priority queue so that the node with the smallest distance
+     *      is at the top. The queue expects a "lower priority than" predicate rather than a three-way
+     *      comparison, so only a positive result of Compare() may count as true.
+     * @param node1 First node in comparison
+     * @param node2 Second node in comparison
+     * @return Returns '1' if node1 is farther than node2, otherwise it returns '0'
+     */
+    static int MinFirst(Node node1, Node node2);
+
+    /**
+     * @brief The ResetSearchState() function resets the distance, previous node and visited vectors so a
+     *      new search can be run from scratch.
+     */
+    void ResetSearchState();
+
+    /**
+     * @brief The Settle() function runs Dijkstra's algorithm from the nodes already in the priority
+     *      queue, relaxing edges until the queue is empty.
+     * @param pq The priority queue of nodes whose distance has been lowered
+     * @return Returns the number of nodes settled
+     */
+    int Settle(std::priority_queue<Node, std::vector<Node>, std::function<int(Node, Node)>>& pq);
+
+    /**
+     * @brief The RepairDecrease() function repairs the shortest path tree after an edge has been added
+     *      or its weight has been decreased.
+     * @param from Id of the node at the start of the directed edge
+     * @param to Id of the node at the end of the directed edge
+     * @param cost The new edge weight
+     * @return Returns the number of nodes touched by the repair
+     */
+    int RepairDecrease(int from, int to, double cost);
+
+    /**
+     * @brief The RepairIncrease() function repairs the shortest path tree after an edge has been removed
+     *      or its weight has been increased.
+     * @param from Id of the node at the start of the directed edge
+     * @param to Id of the node at the end of the directed edge
+     * @return Returns the number of nodes touched by the repair
+     */
+    int RepairIncrease(int from, int to);
+
     public:
     /**
      * @brief DijkstrasAdjacencyList constructor and destructor
@@ -59,12 +119,33 @@ class DijkstrasAdjacencyList
     ~DijkstrasAdjacencyList();
 
     /**
-     * @brief The AddEdge() function adds an edge to the graph.
+     * @brief The AddEdge() function adds an edge to the graph. If a shortest path tree is being
+     *      maintained, it is repaired.
+     * @param from Id of the node at the start of the directed edge
      * @param to Id of the node at the end of the directed edge
      * @param cost The edge weight
      */
     void AddEdge(int from, int to, double cost);
 
+    /**
+     * @brief The UpdateEdgeWeight() function changes the weight of the first edge from 'from' to 'to'. If
+     *      a shortest path tree is being maintained, it is repaired.
+     * @param from Id of the node at the start of the directed edge
+     * @param to Id of the node at the end of the directed edge
+     * @param cost The new edge weight
+     * @return Returns true if the edge exists
+     */
+    bool UpdateEdgeWeight(int from, int to, double cost);
+
+    /**
+     * @brief The RemoveEdge() function removes the first edge from 'from' to 'to'. If a shortest path tree
+     *      is being maintained, it is repaired.
+     * @param from Id of the node at the start of the directed edge
+     * @param to Id of the node at the end of the directed edge
+     * @return Returns true if the edge existed
+     */
+    bool RemoveEdge(int from, int to);
+
     /**
      * @brief The GetGraph() function returns the current graph instance.
      */
@@ -78,6 +159,34 @@ class DijkstrasAdjacencyList
      */
     double Dijkstras(int start, int end);
 
+    /**
+     * @brief The ComputeShortestPaths() function computes the full shortest path tree from 'start' and
+     *      keeps it up to date under subsequent edge updates.
+     * @param start Id of the source node
+     */
+    void ComputeShortestPaths(int start);
+
+    /**
+     * @brief The GetDistance() function returns the distance of a node in the maintained shortest path
+     *      tree.
+     * @param node Id of the node
+     * @return Returns the shortest distance from the source node to 'node'
+     */
+    double GetDistance(int node);
+
+    /**
+     * @brief The GetLastRepairCount() function returns the number of nodes touched by the last repair.
+     * @return Returns the number of nodes whose distance was re-examined by the last edge update
+     */
+    int GetLastRepairCount();
+
+    /**
+     * @brief The GetFullComputeCount() function returns the number of nodes settled by the last call to
+     *      ComputeShortestPaths(), which is the cost a full recompute would have.
+     * @return Returns the number of nodes settled by the full computation
+     */
+    int GetFullComputeCount();
+
     /**
      * @brief The ReconstructPath() function reconstructs the shortest path from the 'start' node to the
      *      'end' node.
@@ -0,0 +1,157 @@
+#include <chrono>
+#include <fstream>
+
+#include "DijkstrasMappedGraph.h"
+
+/**
+ * @file DijkstrasMappedGraph.cpp
+ * @author 0xChristopher
+ * @brief Source file for Dijkstra's Algorithm implementation over a memory mapped CSR graph.
+ */
+
+/**
+ * @brief DijkstrasMappedGraph constructor and destructor
+ */
+DijkstrasMappedGraph::DijkstrasMappedGraph(const MappedGraph& graph)
+    : m_graph(graph), m_nodeCount(graph.NodeCount())
+{
+    // A wider heap makes the frequent decrease key operations cheaper on denser graphs
+    if (m_nodeCount > 0)
+        this->degree = (int) fmax(2, fmin(graph.EdgeCount() / m_nodeCount, m_nodeCount));
+
+    this->dist.resize(m_nodeCount);
+    this->prev.resize(m_nodeCount);
+}
+
+DijkstrasMappedGraph::~DijkstrasMappedGraph()
+{
+
+}
+
+/**
+ * @brief The Dijkstras() function performs Dijkstra's shortest path algorithm.
+ */
+double DijkstrasMappedGraph::Dijkstras(int start, int end)
+{
+    if ((start < 0) || (start >= m_nodeCount) || (end < 0) || (end >= m_nodeCount))
+        throw "Invalid node index";
+
+    for (int i = 0; i < m_nodeCount; i++)
+    {
+        dist[i] = INFINITY;
+        prev[i] = -1;
+    }
+
+    dist[start] = 0;
+
+    // Keep an indexed priority queue of the next most promising node
+    MinIndexedDHeap<double> ipq(degree, m_nodeCount);
+    ipq.Insert(start, 0.0);
+
+    while (!ipq.IsEmpty())
+    {
+        int node = ipq.PeekMinKeyIndex();
+        double minValue = ipq.PollMinValue();
+
+        // We've reached the end node; stop early
+        if (node == end)
+            return minValue;
+
+        // Relax every outgoing edge, which is a contiguous range of the mapped arrays
+        for (uint64_t edge = m_graph.EdgesBegin(node), last = m_graph.EdgesEnd(node); edge < last; edge++)
+        {
+            int to = m_graph.Target(edge);
+            double newDist = dist[node] + m_graph.Weight(edge);
+
+            if (newDist < dist[to])
+            {
+                prev[to] = node;
+                dist[to] = newDist;
+
+                if (!ipq.Contains(to))
+                    ipq.Insert(to, newDist);
+                else
+                    ipq.Decrease(to, newDist);
+            }
+        }
+    }
+
+    // Node is unreachable
+    return INFINITY;
+}
+
+/**
+ * @brief The ReconstructPath() function reconstructs the shortest path from the 'start' node to the
+ *      'end' node.
+ */
+std::list<int> DijkstrasMappedGraph::ReconstructPath(int start, int end)
+{
+    double dist = Dijkstras(start, end);
+    std::list<int> path;
+
+    // Check if the node we're trying to get to is reachable
+    if (dist == INFINITY)
+        return path;
+
+    // Construct path backwords, then reverse it
+    for (int at = end; at != -1; at = prev[at])
+        path.emplace_back(at);
+
+    path.reverse();
+
+    return path;
+}
+
+int main()
+{
+    std::string textPath = "graph.txt";         // Text edge list to be converted
+    std::string graphPath = "graph.csr";        // Binary graph file
+
+    // Write the same graph used by the DijkstrasAdjacencyList example as a text edge list
+    std::ofstream text(textPath);
+    text << "# from to cost\n";
+    text << "0 1 12.5\n";
+    text << "0 2 5.2\n";
+    text << "1 4 3.3\n";
+    text << "3 5 2.2\n";
+    text << "2 5 9.2\n";
+    text.close();
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Converting edge list..." << std::endl;
+    MappedGraph::ConvertEdgeList(textPath, graphPath);
+
+    auto loadStart = std::chrono::steady_clock::now();
+    MappedGraph graph(graphPath);
+    auto loadEnd = std::chrono::steady_clock::now();
+
+    std::cout << "Mapped " << graph.NodeCount() << " nodes and " << graph.EdgeCount() << " edges in " <<
+        std::chrono::duration<double, std::micro>(loadEnd - loadStart).count() << " us" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Print the adjacency list straight out of the mapped arrays
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Adjacency List:" << std::endl;
+
+    for (int i = 0; i < graph.NodeCount(); i++)
+        for (uint64_t edge = graph.EdgesBegin(i); edge < graph.EdgesEnd(i); edge++)
+            std::cout << i << ": [" << i << ", " << graph.Target(edge) << ", " << graph.Weight(edge) <<
+                "]" << std::endl;
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Find the shortest path
+    std::cout << "------------------------------------------------------" << std::endl;
+    DijkstrasMappedGraph dijkstras(graph);
+    std::list<int> path = dijkstras.ReconstructPath(0, 5);
+
+    std::cout << "Path:" << std::endl;
+
+    for (auto it = path.begin(); it != path.end(); ++it)
+        std::cout << *it << " ";
+
+    std::cout << "\nDistance: " << dijkstras.Dijkstras(0, 5) << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <iostream>
+#include <list>
+#include <vector>
+#include <math.h>
+
+#include "../dijkstras-shortest-path-mapped-graph/MappedGraph.h"
+#include "../../data-structures/priority-queue/MinIndexedDHeap.h"
+
+/**
+ * @file DijkstrasMappedGraph.h
+ * @author 0xChristopher
+ * @brief The DijkstrasMappedGraph class implements Dijkstra's shortest path algorithm directly over the
+ *      arrays of a memory mapped CSR graph (see MappedGraph.h). Unlike DijkstrasAdjacencyList, the graph
+ *      is never rebuilt in memory: outgoing edges of a node are a contiguous range of the mapped weight
+ *      and target arrays. This is the eager version of the algorithm, which keeps at most one entry per
+ *      node in an indexed D-ary heap (see MinIndexedDHeap.h) and decreases its key instead of inserting
+ *      duplicates. As in DijkstrasAdjacencyList, the algorithm stops early once the end node is settled.
+ *
+ *      Time Complexity: O(E*log_d(V)) where d = max(2, E/V) is the degree of the heap
+ */
+
+class DijkstrasMappedGraph
+{
+
+    private:
+    const MappedGraph& m_graph;                 // Memory mapped graph
+    int m_nodeCount = 0;                        // Number of nodes in the graph
+    int degree = 2;                             // Degree of the indexed heap
+    std::vector<double> dist;                   // Minimum distance between nodes
+    std::vector<int> prev;                      // Used to reconstruct the shortest path
+
+    public:
+    /**
+     * @brief DijkstrasMappedGraph constructor and destructor
+     * @param graph The memory mapped graph to be searched
+     */
+    DijkstrasMappedGraph(const MappedGraph& graph);
+
+    ~DijkstrasMappedGraph();
+
+    /**
+     * @brief The Dijkstras() function performs Dijkstra's shortest path algorithm.
+     * @param start Id of the starting node
+     * @param end Id of the ending node
+     * @return Returns the shortest distance from the start node to the end node
+     */
+    double Dijkstras(int start, int end);
+
+    /**
+     * @brief The ReconstructPath() function reconstructs the shortest path from the 'start' node to the
+     *      'end' node.
+     * @param start The starting node
+     * @param end The ending node
+     * @return Returns a list of nodes forming the shortest path from 'start' to 'end', or an empty list
+     *      if 'end' is unreachable
+     */
+    std::list<int> ReconstructPath(int start, int end);
+
+};
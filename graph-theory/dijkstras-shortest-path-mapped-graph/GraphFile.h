@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @file GraphFile.h
+ * @author 0xChristopher
+ * @brief The GraphFileHeader struct describes the layout of a binary graph file. A graph file stores a
+ *      directed, weighted graph in Compressed Sparse Row (CSR) form so that it can be memory mapped and
+ *      traversed in place. Every section is 8 byte aligned, so the arrays can be read directly out of the
+ *      mapping without copying.
+ *
+ *      File Layout:
+ *              Header          sizeof(GraphFileHeader) bytes
+ *              Offsets         uint64_t[nodeCount + 1]     edges of node i are [offsets[i], offsets[i + 1])
+ *              Weights         double[edgeCount]           cost of each edge
+ *              Targets         int32_t[edgeCount]          id of the node at the end of each edge
+ */
+
+struct GraphFileHeader
+{
+
+    static constexpr uint64_t MAGIC = 0x4850415247525343ULL;    // "CSRGRAPH" tag used to validate a file
+    static constexpr uint64_t VERSION = 1;                      // Current graph file format version
+
+    uint64_t magic = MAGIC;             // Must equal MAGIC
+    uint64_t version = VERSION;         // Must equal VERSION
+    uint64_t nodeCount = 0;             // Number of nodes in the graph
+    uint64_t edgeCount = 0;             // Number of directed edges in the graph
+
+    /**
+     * @brief The OffsetsPosition() function returns the byte position of the offsets array.
+     * @return Returns the position of the offsets array within the file
+     */
+    uint64_t OffsetsPosition() const
+    {
+        return sizeof(GraphFileHeader);
+    }
+
+    /**
+     * @brief The WeightsPosition() function returns the byte position of the weights array.
+     * @return Returns the position of the weights array within the file
+     */
+    uint64_t WeightsPosition() const
+    {
+        return OffsetsPosition() + (nodeCount + 1) * sizeof(uint64_t);
+    }
+
+    /**
+     * @brief The TargetsPosition() function returns the byte position of the targets array.
+     * @return Returns the position of the targets array within the file
+     */
+    uint64_t TargetsPosition() const
+    {
+        return WeightsPosition() + edgeCount * sizeof(double);
+    }
+
+    /**
+     * @brief The FileSize() function returns the total size of a graph file with this header.
+     * @return Returns the size of the file in bytes
+     */
+    uint64_t FileSize() const
+    {
+        return TargetsPosition() + edgeCount * sizeof(int32_t);
+    }
+
+};
@@ -0,0 +1,363 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../dijkstras-shortest-path-mapped-graph/GraphFile.h"
+
+/**
+ * @file MappedGraph.h
+ * @author 0xChristopher
+ * @brief The MappedGraph class gives read-only access to a binary graph file (see GraphFile.h) by memory
+ *      mapping it. Opening a graph maps the file and validates it in a single sequential pass over the
+ *      offsets and targets; no edge is copied and no per-node or per-edge allocation takes place, so
+ *      startup time is bounded by I/O. The class also provides ConvertEdgeList(), a streaming converter
+ *      from a text edge list into the binary format. The converter makes two passes over the text: the
+ *      first counts the out-degree of every node, and the second writes each edge straight into its CSR
+ *      slot of the mapped output file, so it only needs O(V) memory regardless of the number of edges.
+ *
+ *      Text edge list format: one "from to cost" triple per line, blank lines and lines starting with
+ *      '#' are ignored.
+ *
+ *      NOTE: This class relies on the POSIX mmap() interface.
+ *
+ *      Time Complexity:
+ *              Open                O(V+E)
+ *              ConvertEdgeList     O(V+E)
+ */
+
+class MappedGraph
+{
+
+    private:
+    int fd = -1;                                // File descriptor of the mapped graph file
+    void* mapping = nullptr;                    // Start of the memory mapping
+    size_t mappingSize = 0;                     // Size of the memory mapping in bytes
+    const GraphFileHeader* header = nullptr;    // Graph file header
+    const uint64_t* offsets = nullptr;          // CSR offsets; edges of node i are [offsets[i], offsets[i + 1])
+    const double* weights = nullptr;            // Edge weights
+    const int32_t* targets = nullptr;           // Edge targets
+
+    /**
+     * @brief The ReadEdge() function reads the next edge from a text edge list, skipping blank lines and
+     *      comments.
+     * @param file The text edge list
+     * @param from Id of the node at the start of the directed edge
+     * @param to Id of the node at the end of the directed edge
+     * @param cost The edge weight
+     * @return Returns false once the end of the file has been reached
+     */
+    static bool ReadEdge(FILE* file, long long& from, long long& to, double& cost)
+    {
+        char line[256];
+
+        while (fgets(line, sizeof(line), file) != nullptr)
+        {
+            // Skip leading whitespace, then blank lines and comments
+            char* it = line;
+
+            while (*it == ' ' || *it == '\t')
+                it++;
+
+            if (*it == '#' || *it == '\n' || *it == '\r' || *it == '\0')
+                continue;
+
+            if (sscanf(it, "%lld %lld %lf", &from, &to, &cost) != 3)
+                throw "Malformed edge list line";
+
+            if (from < 0 || to < 0 || from > INT32_MAX || to > INT32_MAX)
+                throw "Node id out of range";
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief The IsValid() function checks that the offsets are non-decreasing and end at the number of
+     *      edges, and that every target is a node of the graph, so that no traversal reads outside the file.
+     * @return Returns true if the CSR arrays are consistent
+     */
+    bool IsValid() const
+    {
+        uint64_t nodeCount = header->nodeCount;
+        uint64_t edgeCount = header->edgeCount;
+
+        if (offsets[0] != 0 || offsets[nodeCount] != edgeCount)
+            return false;
+
+        for (uint64_t i = 0; i < nodeCount; i++)
+        {
+            if (offsets[i] > offsets[i + 1])
+                return false;
+        }
+
+        for (uint64_t e = 0; e < edgeCount; e++)
+        {
+            if (targets[e] < 0 || (uint64_t) targets[e] >= nodeCount)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief The Close() function unmaps the graph file and closes its file descriptor.
+     */
+    void Close()
+    {
+        if (mapping != nullptr)
+            munmap(mapping, mappingSize);
+
+        if (fd != -1)
+            close(fd);
+
+        fd = -1;
+        mapping = nullptr;
+        mappingSize = 0;
+        header = nullptr;
+        offsets = nullptr;
+        weights = nullptr;
+        targets = nullptr;
+    }
+
+    public:
+    /**
+     * @brief MappedGraph constructor and destructor
+     * @param path Path of the binary graph file to be mapped
+     */
+    MappedGraph(const std::string& path)
+    {
+        fd = open(path.c_str(), O_RDONLY);
+
+        if (fd == -1)
+            throw "Unable to open graph file";
+
+        struct stat info;
+
+        if (fstat(fd, &info) == -1 || (size_t) info.st_size < sizeof(GraphFileHeader))
+        {
+            Close();
+            throw "Invalid graph file";
+        }
+
+        mappingSize = (size_t) info.st_size;
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+            Close();
+            throw "Unable to map graph file";
+        }
+
+        // Validate the header before trusting any of the section positions
+        header = (const GraphFileHeader*) mapping;
+
+        if (header->magic != GraphFileHeader::MAGIC || header->version != GraphFileHeader::VERSION ||
+            header->nodeCount > INT32_MAX || header->edgeCount > mappingSize || header->FileSize() != mappingSize)
+        {
+            Close();
+            throw "Invalid graph file";
+        }
+
+        const char* base = (const char*) mapping;
+        offsets = (const uint64_t*) (base + header->OffsetsPosition());
+        weights = (const double*) (base + header->WeightsPosition());
+        targets = (const int32_t*) (base + header->TargetsPosition());
+
+        if (!IsValid())
+        {
+            Close();
+            throw "Invalid graph file";
+        }
+
+        // A search jumps between the edges of unrelated nodes, so reading ahead of a page fault mostly loads
+        // pages that are never used
+        madvise(mapping, mappingSize, MADV_RANDOM);
+    }
+
+    ~MappedGraph()
+    {
+        Close();
+    }
+
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    /**
+     * @brief The ConvertEdgeList() function converts a text edge list into a binary graph file.
+     * @param textPath Path of the text edge list
+     * @param graphPath Path of the binary graph file to be written
+     */
+    static void ConvertEdgeList(const std::string& textPath, const std::string& graphPath)
+    {
+        FILE* text = fopen(textPath.c_str(), "r");
+
+        if (text == nullptr)
+            throw "Unable to open edge list";
+
+        long long from = 0, to = 0;
+        double cost = 0.0;
+        GraphFileHeader fileHeader;
+        std::vector<uint64_t> cursor;           // Out-degree of each node, then its next free edge slot
+
+        // First pass: count the out-degree of every node
+        try
+        {
+            while (ReadEdge(text, from, to, cost))
+            {
+                uint64_t highest = (uint64_t) (from > to ? from : to);
+
+                if (highest >= cursor.size())
+                    cursor.resize(highest + 1, 0);
+
+                cursor[from]++;
+                fileHeader.edgeCount++;
+            }
+        }
+        catch (...)
+        {
+            fclose(text);
+            throw;
+        }
+
+        fileHeader.nodeCount = cursor.size();
+
+        int out = open(graphPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (out == -1)
+        {
+            fclose(text);
+            throw "Unable to create graph file";
+        }
+
+        size_t outSize = (size_t) fileHeader.FileSize();
+
+        if (ftruncate(out, (off_t) outSize) == -1)
+        {
+            fclose(text);
+            close(out);
+            throw "Unable to size graph file";
+        }
+
+        void* outMapping = mmap(nullptr, outSize, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+
+        if (outMapping == MAP_FAILED)
+        {
+            fclose(text);
+            close(out);
+            throw "Unable to map graph file";
+        }
+
+        char* base = (char*) outMapping;
+        uint64_t* outOffsets = (uint64_t*) (base + fileHeader.OffsetsPosition());
+        double* outWeights = (double*) (base + fileHeader.WeightsPosition());
+        int32_t* outTargets = (int32_t*) (base + fileHeader.TargetsPosition());
+
+        memcpy(base, &fileHeader, sizeof(GraphFileHeader));
+
+        // Turn the degrees into offsets; cursor[i] becomes the next free slot of node i
+        uint64_t sum = 0;
+
+        for (uint64_t i = 0; i < fileHeader.nodeCount; i++)
+        {
+            outOffsets[i] = sum;
+            sum += cursor[i];
+            cursor[i] = outOffsets[i];
+        }
+
+        outOffsets[fileHeader.nodeCount] = sum;
+
+        // Second pass: place every edge in its CSR slot
+        rewind(text);
+
+        try
+        {
+            while (ReadEdge(text, from, to, cost))
+            {
+                uint64_t slot = cursor[from]++;
+                outWeights[slot] = cost;
+                outTargets[slot] = (int32_t) to;
+            }
+        }
+        catch (...)
+        {
+            munmap(outMapping, outSize);
+            close(out);
+            fclose(text);
+            throw;
+        }
+
+        munmap(outMapping, outSize);
+        close(out);
+        fclose(text);
+    }
+
+    /**
+     * @brief The NodeCount() function returns the number of nodes in the graph.
+     * @return Returns the number of nodes
+     */
+    int NodeCount() const
+    {
+        return (int) header->nodeCount;
+    }
+
+    /**
+     * @brief The EdgeCount() function returns the number of directed edges in the graph.
+     * @return Returns the number of edges
+     */
+    uint64_t EdgeCount() const
+    {
+        return header->edgeCount;
+    }
+
+    /**
+     * @brief The EdgesBegin() function returns the index of the first outgoing edge of a node.
+     * @param node Id of the node
+     * @return Returns the index of the node's first edge
+     */
+    uint64_t EdgesBegin(int node) const
+    {
+        return offsets[node];
+    }
+
+    /**
+     * @brief The EdgesEnd() function returns one past the index of the last outgoing edge of a node.
+     * @param node Id of the node
+     * @return Returns one past the index of the node's last edge
+     */
+    uint64_t EdgesEnd(int node) const
+    {
+        return offsets[node + 1];
+    }
+
+    /**
+     * @brief The Target() function returns the node at the end of an edge.
+     * @param edge Index of the edge
+     * @return Returns the id of the edge's target node
+     */
+    int Target(uint64_t edge) const
+    {
+        return targets[edge];
+    }
+
+    /**
+     * @brief The Weight() function returns the weight of an edge.
+     * @param edge Index of the edge
+     * @return Returns the edge weight
+     */
+    double Weight(uint64_t edge) const
+    {
+        return weights[edge];
+    }
+
+};
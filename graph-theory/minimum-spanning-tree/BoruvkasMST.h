@@ -0,0 +1,171 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "../minimum-spanning-tree/CsrGraph.h"
+#include "../../data-structures/union-find/UnionFind.h"
+
+/**
+ * @file BoruvkasMST.h
+ * @author 0xChristopher
+ * @brief The BoruvkasMST class implements Boruvka's minimum spanning tree algorithm. Every round, each
+ *      component picks the cheapest edge leaving it, and all of those edges are added to the tree at once,
+ *      which at least halves the number of components. Picking the cheapest edges is the expensive part
+ *      and is split across threads: every thread scans its own slice of the edge list and lowers the
+ *      candidate of both endpoint components with a compare-and-swap. Merging the picked edges is then
+ *      done on one thread with a UnionFind, whose roots are copied into a label array before the next
+ *      parallel scan so the threads never touch the UnionFind itself. Edges that end up inside a
+ *      component are dropped from the list between rounds. Ties are broken by edge index, which keeps
+ *      the picked edges cycle free. If the graph is disconnected, a minimum spanning forest is returned.
+ *
+ *      Time Complexity: O((V+E)*log(V)) with the cheapest edge scan divided across the threads
+ */
+
+class BoruvkasMST
+{
+
+    private:
+    CsrGraph& m_graph;                          // Graph to span
+    int m_numThreads = 1;                       // Number of threads used to scan the edges
+    double cost = 0.0;                          // Total weight of the spanning tree
+    std::vector<int64_t> treeEdges;             // Edge indices of the spanning tree
+
+    /**
+     * @brief The Lighter() function checks if edge 'a' comes before edge 'b' in the (weight, index)
+     *      order.
+     * @param a The first edge index
+     * @param b The second edge index, or -1 for none
+     * @return Returns true if 'a' is lighter than 'b'
+     */
+    bool Lighter(int64_t a, int64_t b) const
+    {
+        if (b == -1)
+            return true;
+
+        double weightA = m_graph.Weight(a);
+        double weightB = m_graph.Weight(b);
+
+        return weightA < weightB || (weightA == weightB && a < b);
+    }
+
+    /**
+     * @brief The Offer() function lowers the cheapest edge candidate of a component.
+     * @param slot The candidate of the component
+     * @param edge The edge to be offered
+     */
+    void Offer(std::atomic<int64_t>& slot, int64_t edge) const
+    {
+        int64_t current = slot.load(std::memory_order_relaxed);
+
+        while (Lighter(edge, current))
+        {
+            if (slot.compare_exchange_weak(current, edge, std::memory_order_relaxed))
+                return;
+        }
+    }
+
+    public:
+    /**
+     * @brief BoruvkasMST constructor and destructor
+     * @param graph The graph to span
+     * @param numThreads The number of threads used to scan the edges
+     */
+    BoruvkasMST(CsrGraph& graph, int numThreads)
+        : m_graph(graph), m_numThreads(std::max(1, numThreads))
+    {
+
+    }
+
+    ~BoruvkasMST()
+    {
+
+    }
+
+    /**
+     * @brief The Solve() function computes the minimum spanning tree.
+     * @return Returns the total weight of the spanning tree
+     */
+    double Solve()
+    {
+        int n = m_graph.NodeCount();
+        UnionFind unionFind(n);
+        std::vector<int> label(n);              // Component root of every node for the current round
+        std::vector<std::atomic<int64_t>> cheapest(n);
+        std::vector<int64_t> edges(m_graph.EdgeCount());
+
+        for (int64_t e = 0; e < (int64_t) edges.size(); e++)
+            edges[e] = e;
+
+        cost = 0.0;
+        treeEdges.clear();
+        treeEdges.reserve(n - 1);
+
+        while (!edges.empty())
+        {
+            for (int i = 0; i < n; i++)
+            {
+                label[i] = unionFind.Find(i);
+                cheapest[i].store(-1, std::memory_order_relaxed);
+            }
+
+            // Drop edges that no longer leave their component
+            edges.erase(std::remove_if(edges.begin(), edges.end(), [&](int64_t e)
+            {
+                return label[m_graph.From(e)] == label[m_graph.To(e)];
+            }), edges.end());
+
+            if (edges.empty())
+                break;
+
+            // Every thread offers the edges of its slice to both endpoint components
+            int parts = (int) std::max<int64_t>(1, std::min<int64_t>(m_numThreads, edges.size() / 1024));
+            std::vector<std::thread> threads;
+
+            for (int t = 0; t < parts; t++)
+            {
+                int64_t first = (int64_t) edges.size() * t / parts;
+                int64_t last = (int64_t) edges.size() * (t + 1) / parts;
+
+                threads.emplace_back([this, &edges, &label, &cheapest, first, last]()
+                {
+                    for (int64_t i = first; i < last; i++)
+                    {
+                        int64_t e = edges[i];
+                        Offer(cheapest[label[m_graph.From(e)]], e);
+                        Offer(cheapest[label[m_graph.To(e)]], e);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            // Add every picked edge; an edge picked by both of its components is only added once
+            for (int i = 0; i < n; i++)
+            {
+                int64_t e = cheapest[i].load(std::memory_order_relaxed);
+
+                if (e == -1 || !unionFind.Unify(m_graph.From(e), m_graph.To(e)))
+                    continue;
+
+                treeEdges.emplace_back(e);
+                cost += m_graph.Weight(e);
+            }
+        }
+
+        return cost;
+    }
+
+    /**
+     * @brief The GetTreeEdges() function returns the edges of the last computed spanning tree.
+     * @return Returns the edge indices of the spanning tree
+     */
+    const std::vector<int64_t>& GetTreeEdges()
+    {
+        return treeEdges;
+    }
+
+};
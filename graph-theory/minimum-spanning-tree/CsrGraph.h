@@ -0,0 +1,197 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @file CsrGraph.h
+ * @author 0xChristopher
+ * @brief The CsrGraph class stores an undirected, weighted graph for the minimum spanning tree engines
+ *      (see KruskalsMST.h, PrimsMST.h and BoruvkasMST.h). Every undirected edge is kept once in a flat
+ *      edge list, which is what Kruskal's and Boruvka's algorithms scan, and twice in a Compressed Sparse
+ *      Row (CSR) adjacency, which is what Prim's algorithm walks. Each adjacency entry records the index
+ *      of the edge it came from, so all three engines report their trees as edge indices.
+ *
+ *      Node ids are 32-bit, but edge indices, adjacency offsets and counts are 64-bit, since a graph with a
+ *      few million nodes can easily have more than 2^31 adjacency entries.
+ *
+ *      Time Complexity: Build: O(V+E)
+ *      Space Complexity: O(V+E)
+ */
+
+class CsrGraph
+{
+
+    private:
+    int m_nodeCount = 0;                        // Number of nodes in the graph
+    bool built = false;                         // Set to true once the CSR adjacency is up to date
+    std::vector<int> edgeFrom;                  // First endpoint of each edge
+    std::vector<int> edgeTo;                    // Second endpoint of each edge
+    std::vector<double> edgeWeight;             // Weight of each edge
+    std::vector<int64_t> offsets;               // Adjacency of node i is [offsets[i], offsets[i + 1])
+    std::vector<int> adjacentNode;              // Node at the other end of each adjacency entry
+    std::vector<int64_t> adjacentEdge;          // Edge index of each adjacency entry
+
+    public:
+    /**
+     * @brief CsrGraph constructor and destructor
+     * @param nodeCount The number of nodes in the graph
+     */
+    CsrGraph(int nodeCount)
+        : m_nodeCount(nodeCount)
+    {
+        if (nodeCount <= 0)
+            throw "Node count must be greater than zero";
+    }
+
+    ~CsrGraph()
+    {
+
+    }
+
+    /**
+     * @brief The AddEdge() function adds an undirected edge to the graph.
+     * @param from Id of the first endpoint
+     * @param to Id of the second endpoint
+     * @param weight The edge weight
+     */
+    void AddEdge(int from, int to, double weight)
+    {
+        if ((from < 0) || (from >= m_nodeCount) || (to < 0) || (to >= m_nodeCount))
+            throw "Invalid node index";
+
+        edgeFrom.emplace_back(from);
+        edgeTo.emplace_back(to);
+        edgeWeight.emplace_back(weight);
+        built = false;
+    }
+
+    /**
+     * @brief The Build() function builds the CSR adjacency from the edge list with a counting sort. It
+     *      is called automatically by the engines and only does work after edges have been added.
+     */
+    void Build()
+    {
+        if (built)
+            return;
+
+        int64_t edgeCount = EdgeCount();
+        offsets.assign((size_t) m_nodeCount + 1, 0);
+        adjacentNode.resize(2 * (size_t) edgeCount);
+        adjacentEdge.resize(2 * (size_t) edgeCount);
+
+        // Count the degree of every node, then turn the counts into offsets
+        for (int64_t e = 0; e < edgeCount; e++)
+        {
+            offsets[edgeFrom[e] + 1]++;
+            offsets[edgeTo[e] + 1]++;
+        }
+
+        for (int i = 0; i < m_nodeCount; i++)
+            offsets[i + 1] += offsets[i];
+
+        std::vector<int64_t> cursor(offsets.begin(), offsets.end() - 1);
+
+        for (int64_t e = 0; e < edgeCount; e++)
+        {
+            int64_t slot = cursor[edgeFrom[e]]++;
+            adjacentNode[slot] = edgeTo[e];
+            adjacentEdge[slot] = e;
+
+            slot = cursor[edgeTo[e]]++;
+            adjacentNode[slot] = edgeFrom[e];
+            adjacentEdge[slot] = e;
+        }
+
+        built = true;
+    }
+
+    /**
+     * @brief The NodeCount() function returns the number of nodes in the graph.
+     * @return Returns the number of nodes
+     */
+    int NodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    /**
+     * @brief The EdgeCount() function returns the number of undirected edges in the graph.
+     * @return Returns the number of edges
+     */
+    int64_t EdgeCount() const
+    {
+        return (int64_t) edgeWeight.size();
+    }
+
+    /**
+     * @brief The From() function returns the first endpoint of an edge.
+     * @param e The edge index
+     * @return Returns the id of the first endpoint
+     */
+    int From(int64_t e) const
+    {
+        return edgeFrom[e];
+    }
+
+    /**
+     * @brief The To() function returns the second endpoint of an edge.
+     * @param e The edge index
+     * @return Returns the id of the second endpoint
+     */
+    int To(int64_t e) const
+    {
+        return edgeTo[e];
+    }
+
+    /**
+     * @brief The Weight() function returns the weight of an edge.
+     * @param e The edge index
+     * @return Returns the edge weight
+     */
+    double Weight(int64_t e) const
+    {
+        return edgeWeight[e];
+    }
+
+    /**
+     * @brief The AdjacencyBegin() function returns the first adjacency entry of a node.
+     * @param node Id of the node
+     * @return Returns the index of the node's first adjacency entry
+     */
+    int64_t AdjacencyBegin(int node) const
+    {
+        return offsets[node];
+    }
+
+    /**
+     * @brief The AdjacencyEnd() function returns one past the last adjacency entry of a node.
+     * @param node Id of the node
+     * @return Returns one past the index of the node's last adjacency entry
+     */
+    int64_t AdjacencyEnd(int node) const
+    {
+        return offsets[node + 1];
+    }
+
+    /**
+     * @brief The AdjacentNode() function returns the node at the other end of an adjacency entry.
+     * @param i The adjacency entry
+     * @return Returns the id of the neighbouring node
+     */
+    int AdjacentNode(int64_t i) const
+    {
+        return adjacentNode[i];
+    }
+
+    /**
+     * @brief The AdjacentEdge() function returns the edge an adjacency entry belongs to.
+     * @param i The adjacency entry
+     * @return Returns the edge index
+     */
+    int64_t AdjacentEdge(int64_t i) const
+    {
+        return adjacentEdge[i];
+    }
+
+};
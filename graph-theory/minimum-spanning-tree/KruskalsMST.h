@@ -0,0 +1,149 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include "../minimum-spanning-tree/CsrGraph.h"
+#include "../../data-structures/union-find/UnionFind.h"
+
+/**
+ * @file KruskalsMST.h
+ * @author 0xChristopher
+ * @brief The KruskalsMST class implements Kruskal's minimum spanning tree algorithm. Edges are sorted by
+ *      weight and then considered from lightest to heaviest; an edge joins the tree whenever its
+ *      endpoints are still in different components of a UnionFind. Sorting dominates the running time,
+ *      so the edge order is produced by a parallel sort: every thread sorts its own slice of the edges,
+ *      and the sorted slices are then merged pairwise, one merge per thread, until a single run is left.
+ *      Ties are broken by edge index so the result does not depend on the number of threads. If the
+ *      graph is disconnected, a minimum spanning forest is returned.
+ *
+ *      Time Complexity: O(E*log(E)/p + E*a(V)) where p is the number of threads
+ */
+
+class KruskalsMST
+{
+
+    private:
+    CsrGraph& m_graph;                          // Graph to span
+    int m_numThreads = 1;                       // Number of threads used to sort the edges
+    double cost = 0.0;                          // Total weight of the spanning tree
+    std::vector<int64_t> treeEdges;             // Edge indices of the spanning tree
+
+    /**
+     * @brief The ParallelSort() function sorts edge indices by weight across several threads.
+     * @param order The edge indices to be sorted
+     */
+    void ParallelSort(std::vector<int64_t>& order)
+    {
+        const CsrGraph& graph = m_graph;
+        auto lighter = [&graph](int64_t a, int64_t b)
+        {
+            return graph.Weight(a) < graph.Weight(b) || (graph.Weight(a) == graph.Weight(b) && a < b);
+        };
+
+        int parts = (int) std::max<int64_t>(1, std::min<int64_t>(m_numThreads, order.size() / 1024));
+        std::vector<int64_t> bounds(parts + 1);
+
+        for (int i = 0; i <= parts; i++)
+            bounds[i] = (int64_t) order.size() * i / parts;
+
+        // Sort every slice on its own thread
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < parts; i++)
+        {
+            threads.emplace_back([&order, &bounds, i, lighter]()
+            {
+                std::sort(order.begin() + bounds[i], order.begin() + bounds[i + 1], lighter);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // Merge neighbouring runs pairwise until a single sorted run is left
+        for (int width = 1; width < parts; width *= 2)
+        {
+            threads.clear();
+
+            for (int i = 0; i + width < parts; i += 2 * width)
+            {
+                int64_t first = bounds[i];
+                int64_t middle = bounds[i + width];
+                int64_t last = bounds[std::min(i + 2 * width, parts)];
+
+                threads.emplace_back([&order, first, middle, last, lighter]()
+                {
+                    std::inplace_merge(order.begin() + first, order.begin() + middle, order.begin() + last,
+                        lighter);
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+    }
+
+    public:
+    /**
+     * @brief KruskalsMST constructor and destructor
+     * @param graph The graph to span
+     * @param numThreads The number of threads used to sort the edges
+     */
+    KruskalsMST(CsrGraph& graph, int numThreads)
+        : m_graph(graph), m_numThreads(std::max(1, numThreads))
+    {
+
+    }
+
+    ~KruskalsMST()
+    {
+
+    }
+
+    /**
+     * @brief The Solve() function computes the minimum spanning tree.
+     * @return Returns the total weight of the spanning tree
+     */
+    double Solve()
+    {
+        int n = m_graph.NodeCount();
+        int64_t edgeCount = m_graph.EdgeCount();
+        std::vector<int64_t> order(edgeCount);
+
+        for (int64_t e = 0; e < edgeCount; e++)
+            order[e] = e;
+
+        ParallelSort(order);
+
+        UnionFind unionFind(n);
+        cost = 0.0;
+        treeEdges.clear();
+        treeEdges.reserve(n - 1);
+
+        // Take the lightest edge that connects two components until only one is left
+        for (int64_t i = 0; i < edgeCount && unionFind.Components() > 1; i++)
+        {
+            int64_t e = order[i];
+
+            if (!unionFind.Unify(m_graph.From(e), m_graph.To(e)))
+                continue;
+
+            treeEdges.emplace_back(e);
+            cost += m_graph.Weight(e);
+        }
+
+        return cost;
+    }
+
+    /**
+     * @brief The GetTreeEdges() function returns the edges of the last computed spanning tree.
+     * @return Returns the edge indices of the spanning tree
+     */
+    const std::vector<int64_t>& GetTreeEdges()
+    {
+        return treeEdges;
+    }
+
+};
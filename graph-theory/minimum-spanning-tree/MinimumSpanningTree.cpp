@@ -0,0 +1,105 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <functional>
+
+#include "KruskalsMST.h"
+#include "PrimsMST.h"
+#include "BoruvkasMST.h"
+
+/**
+ * @file MinimumSpanningTree.cpp
+ * @author 0xChristopher
+ * @brief Functional demonstration and benchmark of Kruskal's, Prim's and Boruvka's minimum spanning tree
+ *      algorithms over a shared CsrGraph.
+ */
+
+/**
+ * @brief The RandomGraph() function builds a connected random graph. A random spanning path keeps the
+ *      graph connected, and the remaining edges join uniformly random node pairs.
+ * @param nodeCount The number of nodes in the graph
+ * @param edgeCount The number of edges in the graph
+ * @return Returns the random graph
+ */
+CsrGraph RandomGraph(int nodeCount, int edgeCount)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> randomNode(0, nodeCount - 1);
+    std::uniform_real_distribution<double> randomWeight(0.0, 1000.0);
+    CsrGraph graph(nodeCount);
+
+    for (int i = 1; i < nodeCount; i++)
+        graph.AddEdge(i - 1, i, randomWeight(rng));
+
+    for (int i = nodeCount - 1; i < edgeCount; i++)
+        graph.AddEdge(randomNode(rng), randomNode(rng), randomWeight(rng));
+
+    graph.Build();
+
+    return graph;
+}
+
+/**
+ * @brief The Benchmark() function times one minimum spanning tree engine.
+ * @param name The name of the engine
+ * @param solve Runs the engine and returns the weight of the tree
+ */
+void Benchmark(const std::string& name, const std::function<double()>& solve)
+{
+    auto start = std::chrono::steady_clock::now();
+    double cost = solve();
+    auto end = std::chrono::steady_clock::now();
+
+    printf("%-10s cost: %16.3f %10.1f ms\n", name.c_str(), cost,
+        std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+int main()
+{
+    int numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Small example
+    std::cout << "------------------------------------------------------" << std::endl;
+    CsrGraph graph(5);
+    graph.AddEdge(0, 1, 4.0);
+    graph.AddEdge(0, 2, 1.0);
+    graph.AddEdge(1, 2, 2.0);
+    graph.AddEdge(1, 3, 5.0);
+    graph.AddEdge(2, 3, 8.0);
+    graph.AddEdge(3, 4, 3.0);
+
+    KruskalsMST kruskals(graph, numThreads);
+    std::cout << "Kruskal's MST cost: " << kruskals.Solve() << "\nEdges: ";
+
+    for (int64_t e : kruskals.GetTreeEdges())
+        std::cout << "(" << graph.From(e) << ", " << graph.To(e) << ") ";
+
+    PrimsMST prims(graph);
+    BoruvkasMST boruvkas(graph, numThreads);
+    std::cout << "\nPrim's MST cost: " << prims.Solve() << std::endl;
+    std::cout << "Boruvka's MST cost: " << boruvkas.Solve() << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // Benchmark on a sparse and a dense graph
+    int sizes[2][2] = {{200000, 1000000}, {4000, 4000000}};
+    const char* names[2] = {"Sparse", "Dense"};
+
+    for (int i = 0; i < 2; i++)
+    {
+        std::cout << "------------------------------------------------------" << std::endl;
+        std::cout << names[i] << " graph: " << sizes[i][0] << " nodes, " << sizes[i][1] << " edges, " <<
+            numThreads << " threads" << std::endl;
+
+        CsrGraph random = RandomGraph(sizes[i][0], sizes[i][1]);
+        KruskalsMST kruskalsRandom(random, numThreads);
+        PrimsMST primsRandom(random);
+        BoruvkasMST boruvkasRandom(random, numThreads);
+
+        Benchmark("Kruskal", [&]() { return kruskalsRandom.Solve(); });
+        Benchmark("Prim", [&]() { return primsRandom.Solve(); });
+        Benchmark("Boruvka", [&]() { return boruvkasRandom.Solve(); });
+        std::cout << "------------------------------------------------------" << std::endl;
+    }
+
+    return 0;
+}
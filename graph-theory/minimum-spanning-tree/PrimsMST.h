@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+#include <math.h>
+
+#include "../minimum-spanning-tree/CsrGraph.h"
+#include "../../data-structures/priority-queue/MinIndexedDHeap.h"
+
+/**
+ * @file PrimsMST.h
+ * @author 0xChristopher
+ * @brief The PrimsMST class implements the eager version of Prim's minimum spanning tree algorithm. The
+ *      tree is grown one node at a time, and for every node outside of the tree an indexed D-ary heap
+ *      (see MinIndexedDHeap.h) keeps only the cheapest edge known to reach it. When a cheaper edge is
+ *      found its key is lowered with Decrease() instead of pushing a duplicate entry, so the heap never
+ *      holds more than V entries. If the graph is disconnected, the tree is restarted from the next
+ *      unvisited node and a minimum spanning forest is returned.
+ *
+ *      NOTE: MinIndexedDHeap reserves the value -1 as its null value, so edge weights may not be -1.
+ *
+ *      Time Complexity: O(E*log_d(V)) where d = max(2, E/V) is the degree of the heap
+ */
+
+class PrimsMST
+{
+
+    private:
+    CsrGraph& m_graph;                          // Graph to span
+    double cost = 0.0;                          // Total weight of the spanning tree
+    std::vector<int64_t> treeEdges;             // Edge indices of the spanning tree
+
+    public:
+    /**
+     * @brief PrimsMST constructor and destructor
+     * @param graph The graph to span
+     */
+    PrimsMST(CsrGraph& graph)
+        : m_graph(graph)
+    {
+
+    }
+
+    ~PrimsMST()
+    {
+
+    }
+
+    /**
+     * @brief The Solve() function computes the minimum spanning tree.
+     * @return Returns the total weight of the spanning tree
+     */
+    double Solve()
+    {
+        m_graph.Build();
+
+        int n = m_graph.NodeCount();
+        int degree = (int) fmax(2, fmin((2.0 * m_graph.EdgeCount()) / n, n));
+        std::vector<bool> visited(n, false);
+        std::vector<int64_t> bestEdge(n, -1);   // Cheapest known edge into each node outside the tree
+        MinIndexedDHeap<double> ipq(degree, n);
+
+        cost = 0.0;
+        treeEdges.clear();
+        treeEdges.reserve(n - 1);
+
+        for (int start = 0; start < n; start++)
+        {
+            if (visited[start])
+                continue;
+
+            ipq.Insert(start, 0.0);
+
+            while (!ipq.IsEmpty())
+            {
+                int node = ipq.PollMinKeyIndex();
+                visited[node] = true;
+
+                if (bestEdge[node] != -1)
+                {
+                    treeEdges.emplace_back(bestEdge[node]);
+                    cost += m_graph.Weight(bestEdge[node]);
+                }
+
+                // Offer every edge leaving the tree through this node
+                for (int64_t i = m_graph.AdjacencyBegin(node); i < m_graph.AdjacencyEnd(node); i++)
+                {
+                    int next = m_graph.AdjacentNode(i);
+                    int64_t edge = m_graph.AdjacentEdge(i);
+
+                    if (visited[next])
+                        continue;
+
+                    double weight = m_graph.Weight(edge);
+
+                    if (!ipq.Contains(next))
+                    {
+                        ipq.Insert(next, weight);
+                        bestEdge[next] = edge;
+                    }
+                    else if (weight < ipq.ValueOf(next))
+                    {
+                        ipq.Decrease(next, weight);
+                        bestEdge[next] = edge;
+                    }
+                }
+            }
+        }
+
+        return cost;
+    }
+
+    /**
+     * @brief The GetTreeEdges() function returns the edges of the last computed spanning tree.
+     * @return Returns the edge indices of the spanning tree
+     */
+    const std::vector<int64_t>& GetTreeEdges()
+    {
+        return treeEdges;
+    }
+
+};